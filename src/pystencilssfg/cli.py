@@ -3,7 +3,7 @@ import os
 from os import path
 from typing import NoReturn
 
-from argparse import ArgumentParser, BooleanOptionalAction
+from argparse import ArgumentParser, BooleanOptionalAction, REMAINDER
 
 from .config import CommandLineParameters, SfgConfigException
 
@@ -41,6 +41,41 @@ def cli_main(program="sfg-cli") -> NoReturn:
     )
     outfiles_parser.add_argument("codegen_script", type=str)
 
+    batch_parser = subparsers.add_parser(
+        "batch",
+        help="Run multiple codegen scripts in a single Python process.",
+    )
+    batch_parser.set_defaults(func=run_batch)
+    batch_parser.add_argument(
+        "--keep-going",
+        action="store_true",
+        help="Continue running the remaining scripts after a script has failed.",
+    )
+    batch_parser.add_argument("codegen_scripts", type=str, nargs="+")
+    batch_parser.add_argument(
+        "--args",
+        nargs=REMAINDER,
+        default=[],
+        dest="script_args",
+        help="Command line arguments passed on to each codegen script. "
+        "Must be specified last.",
+    )
+
+    profiles_parser = subparsers.add_parser(
+        "aggregate-profiles",
+        help="Combine the profiling reports of several codegen scripts.",
+    )
+    profiles_parser.set_defaults(func=aggregate_profiles)
+    profiles_parser.add_argument("reports", type=str, nargs="+")
+    profiles_parser.add_argument(
+        "-o",
+        "--output",
+        type=str,
+        default=None,
+        dest="output",
+        help="File to write the aggregated report to; defaults to standard output.",
+    )
+
     cmake_parser = subparsers.add_parser(
         "cmake", help="Operations for CMake integation"
     )
@@ -90,6 +125,89 @@ def list_files(args) -> NoReturn:
     exit(0)
 
 
+def run_batch(args) -> NoReturn:
+    """Run several generator scripts within this process.
+
+    Each script is executed as ``__main__`` with its own globals,
+    a fresh ``sys.argv`` and its directory prepended to ``sys.path``.
+    Modules imported from the scripts' directories, as well as global
+    configuration changed by the scripts, are reset after each run;
+    all other modules (e.g. pystencils, sympy) stay loaded,
+    such that their import cost is paid only once.
+    """
+    import runpy
+    import traceback
+
+    from .lang.cpp import StdMdspan
+
+    failed: list[str] = []
+
+    for script in args.codegen_scripts:
+        script_path = path.abspath(script)
+        script_dir = path.dirname(script_path)
+
+        saved_argv = sys.argv
+        saved_path = list(sys.path)
+        saved_modules = set(sys.modules.keys())
+        saved_mdspan_config = (StdMdspan._namespace, StdMdspan._template)
+
+        sys.argv = [script_path] + list(args.script_args)
+        sys.path.insert(0, script_dir)
+
+        try:
+            runpy.run_path(script_path, run_name="__main__")
+        except SystemExit as e:
+            if e.code not in (None, 0):
+                failed.append(script)
+        except Exception:
+            traceback.print_exc()
+            failed.append(script)
+        finally:
+            sys.argv = saved_argv
+            sys.path[:] = saved_path
+            StdMdspan._namespace, StdMdspan._template = saved_mdspan_config
+
+            for modname in set(sys.modules.keys()) - saved_modules:
+                modfile = getattr(sys.modules[modname], "__file__", None)
+                if modfile is not None and path.abspath(modfile).startswith(
+                    script_dir + os.sep
+                ):
+                    del sys.modules[modname]
+
+        if failed and not args.keep_going:
+            break
+
+    if failed:
+        print(
+            f"Code generation failed for script(s): {', '.join(failed)}",
+            file=sys.stderr,
+        )
+        exit(1)
+
+    exit(0)
+
+
+def aggregate_profiles(args) -> NoReturn:
+    import json
+
+    from .generator_profile import aggregate_reports
+
+    reports = []
+    for report_file in args.reports:
+        with open(report_file, "r") as f:
+            reports.append(json.load(f))
+
+    aggregated = json.dumps(aggregate_reports(reports), indent=2)
+
+    if args.output is None:
+        print(aggregated)
+    else:
+        with open(args.output, "w") as f:
+            f.write(aggregated)
+
+    exit(0)
+
+
 def print_cmake_modulepath(args) -> NoReturn:
     from .cmake import get_sfg_cmake_modulepath
 
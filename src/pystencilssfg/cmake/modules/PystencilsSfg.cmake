@@ -19,22 +19,43 @@ if(NOT DEFINED CACHE{_Pystencils_Include_Dir})
     set(_Pystencils_Include_Dir ${_pystencils_includepath_result} CACHE PATH "")
 endif()
 
-function(_pssfg_add_gen_source target script outputDirectory)
+function(_pssfg_get_generated_files outVar script outputDirectory)
     set(options)
     set(oneValueArgs)
-    set(multiValueArgs GENERATOR_ARGS USER_ARGS DEPENDS)
+    set(multiValueArgs GENERATOR_ARGS)
 
     cmake_parse_arguments(_pssfg "${options}" "${oneValueArgs}" "${multiValueArgs}" ${ARGN})
 
-    get_filename_component(basename ${script} NAME_WLE)
-    cmake_path(ABSOLUTE_PATH script OUTPUT_VARIABLE scriptAbsolute)
+    #   The output file names depend only on the script's name, the generator arguments,
+    #   and the contents of the configuration module (if any);
+    #   cache them to avoid starting a Python interpreter on every reconfiguration.
+    get_filename_component(scriptName ${script} NAME)
+    set(cacheKeyInputs ${PystencilsSfg_PYTHON_INTERPRETER} ${PystencilsSfg_VERSION} ${scriptName} ${_pssfg_GENERATOR_ARGS})
+
+    foreach(arg ${_pssfg_GENERATOR_ARGS})
+        if(arg MATCHES "^--sfg-config-module=(.*)$")
+            file(SHA256 ${CMAKE_MATCH_1} configModuleHash)
+            list(APPEND cacheKeyInputs ${configModuleHash})
+            #   Reconfigure if the config module changes, since it may alter the output files
+            set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS ${CMAKE_MATCH_1})
+        endif()
+    endforeach()
+
+    string(SHA256 cacheKey "${cacheKeyInputs}")
+    set(cacheVar _PystencilsSfg_GENERATED_FILES_${cacheKey})
 
-    execute_process(COMMAND ${PystencilsSfg_PYTHON_INTERPRETER} -m pystencilssfg list-files "--sep=;" --no-newline ${_pssfg_GENERATOR_ARGS} ${script}
-                    OUTPUT_VARIABLE generatedSources RESULT_VARIABLE _pssfg_result
-                    ERROR_VARIABLE _pssfg_stderr)
+    if(DEFINED CACHE{${cacheVar}})
+        set(generatedSources $CACHE{${cacheVar}})
+    else()
+        execute_process(COMMAND ${PystencilsSfg_PYTHON_INTERPRETER} -m pystencilssfg list-files "--sep=;" --no-newline ${_pssfg_GENERATOR_ARGS} ${script}
+                        OUTPUT_VARIABLE generatedSources RESULT_VARIABLE _pssfg_result
+                        ERROR_VARIABLE _pssfg_stderr)
+
+        if(NOT (${_pssfg_result} EQUAL 0))
+            message( FATAL_ERROR ${_pssfg_stderr} )
+        endif()
 
-    if(NOT (${_pssfg_result} EQUAL 0))
-        message( FATAL_ERROR ${_pssfg_stderr} )
+        set(${cacheVar} "${generatedSources}" CACHE INTERNAL "Output files of pystencils-sfg script ${scriptName}")
     endif()
 
     set(generatedSourcesAbsolute)
@@ -42,20 +63,129 @@ function(_pssfg_add_gen_source target script outputDirectory)
         list(APPEND generatedSourcesAbsolute "${outputDirectory}/${filename}")
     endforeach ()
 
+    if("--sfg-profile" IN_LIST _pssfg_GENERATOR_ARGS)
+        #   Profiling report written by the generator; see `GeneratorProfile`
+        get_filename_component(scriptStem ${script} NAME_WE)
+        list(APPEND generatedSourcesAbsolute "${outputDirectory}/${scriptStem}.sfg-profile.json")
+    endif()
+
+    set(${outVar} ${generatedSourcesAbsolute} PARENT_SCOPE)
+endfunction()
+
+
+#   Register the profiling reports of the given scripts with the target;
+#   they are combined into `<target>.sfg-profile.json` by a single rule
+#   created at the end of the current directory, see `_pssfg_create_profile_report`.
+function(_pssfg_add_profile_report target outputDirectory)
+    set(options)
+    set(oneValueArgs)
+    set(multiValueArgs SCRIPTS)
+
+    cmake_parse_arguments(_pssfg "${options}" "${oneValueArgs}" "${multiValueArgs}" ${ARGN})
+
+    set(reports)
+    foreach(script ${_pssfg_SCRIPTS})
+        get_filename_component(scriptStem ${script} NAME_WE)
+        list(APPEND reports "${outputDirectory}/${scriptStem}.sfg-profile.json")
+    endforeach()
+
+    get_target_property(registeredReports ${target} _PystencilsSfg_PROFILE_REPORTS)
+    if(NOT registeredReports)
+        #   Arguments of deferred calls are only evaluated when the call is executed
+        cmake_language(EVAL CODE "cmake_language(DEFER CALL _pssfg_create_profile_report [[${target}]])")
+    endif()
+
+    set_property(TARGET ${target} APPEND PROPERTY _PystencilsSfg_PROFILE_REPORTS ${reports})
+endfunction()
+
+
+function(_pssfg_create_profile_report target)
+    get_target_property(reports ${target} _PystencilsSfg_PROFILE_REPORTS)
+    set(targetReport ${CMAKE_CURRENT_BINARY_DIR}/${target}.sfg-profile.json)
+
+    add_custom_command(OUTPUT ${targetReport}
+                       DEPENDS ${reports}
+                       COMMAND ${PystencilsSfg_PYTHON_INTERPRETER} -m pystencilssfg aggregate-profiles ${reports} -o ${targetReport})
+
+    target_sources(${target} PRIVATE ${targetReport})
+endfunction()
+
+
+function(_pssfg_add_gen_source target script outputDirectory)
+    set(options)
+    set(oneValueArgs)
+    set(multiValueArgs GENERATOR_ARGS USER_ARGS DEPENDS)
+
+    cmake_parse_arguments(_pssfg "${options}" "${oneValueArgs}" "${multiValueArgs}" ${ARGN})
+
+    cmake_path(ABSOLUTE_PATH script OUTPUT_VARIABLE scriptAbsolute)
+
+    _pssfg_get_generated_files(
+        generatedSourcesAbsolute ${script} ${outputDirectory}
+        GENERATOR_ARGS ${_pssfg_GENERATOR_ARGS}
+    )
+
     file(MAKE_DIRECTORY ${outputDirectory})
 
-    add_custom_command(OUTPUT ${generatedSourcesAbsolute}
+    #   The generator leaves unchanged output files untouched, so their modification times
+    #   cannot tell the build system whether the script is up to date; a stamp file does.
+    get_filename_component(scriptStem ${script} NAME_WE)
+    set(stampFile "${outputDirectory}/.${scriptStem}.sfg-stamp")
+
+    add_custom_command(OUTPUT ${stampFile}
+                       BYPRODUCTS ${generatedSourcesAbsolute}
                        DEPENDS ${scriptAbsolute} ${_pssfg_DEPENDS}
                        COMMAND ${PystencilsSfg_PYTHON_INTERPRETER} ${scriptAbsolute} ${_pssfg_GENERATOR_ARGS} ${_pssfg_USER_ARGS}
+                       COMMAND ${CMAKE_COMMAND} -E touch ${stampFile}
                        WORKING_DIRECTORY "${outputDirectory}")
 
-    target_sources(${target} PRIVATE ${generatedSourcesAbsolute})
+    target_sources(${target} PRIVATE ${generatedSourcesAbsolute} ${stampFile})
+endfunction()
+
+
+#   Run all given scripts through a single invocation of `sfg-cli batch`,
+#   such that the Python interpreter and pystencils are only loaded once.
+function(_pssfg_add_gen_sources_batch target outputDirectory)
+    set(options)
+    set(oneValueArgs)
+    set(multiValueArgs SCRIPTS GENERATOR_ARGS USER_ARGS DEPENDS)
+
+    cmake_parse_arguments(_pssfg "${options}" "${oneValueArgs}" "${multiValueArgs}" ${ARGN})
+
+    set(scriptsAbsolute)
+    set(generatedSourcesAbsolute)
+    foreach(script ${_pssfg_SCRIPTS})
+        cmake_path(ABSOLUTE_PATH script OUTPUT_VARIABLE scriptAbsolute)
+        list(APPEND scriptsAbsolute ${scriptAbsolute})
+
+        _pssfg_get_generated_files(
+            scriptOutputs ${script} ${outputDirectory}
+            GENERATOR_ARGS ${_pssfg_GENERATOR_ARGS}
+        )
+        list(APPEND generatedSourcesAbsolute ${scriptOutputs})
+    endforeach()
+
+    file(MAKE_DIRECTORY ${outputDirectory})
+
+    #   See `_pssfg_add_gen_source`
+    string(SHA256 scriptsHash "${scriptsAbsolute}")
+    string(SUBSTRING ${scriptsHash} 0 16 scriptsHash)
+    set(stampFile "${outputDirectory}/.batch-${scriptsHash}.sfg-stamp")
+
+    add_custom_command(OUTPUT ${stampFile}
+                       BYPRODUCTS ${generatedSourcesAbsolute}
+                       DEPENDS ${scriptsAbsolute} ${_pssfg_DEPENDS}
+                       COMMAND ${PystencilsSfg_PYTHON_INTERPRETER} -m pystencilssfg batch ${scriptsAbsolute} --args ${_pssfg_GENERATOR_ARGS} ${_pssfg_USER_ARGS}
+                       COMMAND ${CMAKE_COMMAND} -E touch ${stampFile}
+                       WORKING_DIRECTORY "${outputDirectory}")
+
+    target_sources(${target} PRIVATE ${generatedSourcesAbsolute} ${stampFile})
 endfunction()
 
 
 function(pystencilssfg_generate_target_sources TARGET)
-    set(options HEADER_ONLY)
-    set(oneValueArgs CONFIG_MODULE OUTPUT_DIRECTORY)
+    set(options HEADER_ONLY BATCH)
+    set(oneValueArgs CONFIG_MODULE OUTPUT_DIRECTORY IMPL_SHARDS)
     set(multiValueArgs SCRIPTS DEPENDS FILE_EXTENSIONS SCRIPT_ARGS)
     cmake_parse_arguments(_pssfg "${options}" "${oneValueArgs}" "${multiValueArgs}" ${ARGN})
 
@@ -109,19 +239,49 @@ function(pystencilssfg_generate_target_sources TARGET)
         list(APPEND generatorArgs "--sfg-file-extensions=${extensionsString}")
     endif()
 
+    if(DEFINED _pssfg_IMPL_SHARDS)
+        list(APPEND generatorArgs "--sfg-impl-shards=${_pssfg_IMPL_SHARDS}")
+    endif()
+
+    if(DEFINED PystencilsSfg_KERNEL_CACHE)
+        cmake_path(ABSOLUTE_PATH PystencilsSfg_KERNEL_CACHE BASE_DIRECTORY ${CMAKE_BINARY_DIR} OUTPUT_VARIABLE kernelCacheDir)
+        list(APPEND generatorArgs "--sfg-kernel-cache=${kernelCacheDir}")
+    endif()
+
+    if(PystencilsSfg_PROFILE)
+        list(APPEND generatorArgs "--sfg-profile")
+    endif()
+
     if(DEFINED _pssfg_SCRIPT_ARGS)
         #   User has provided custom command line arguments
         set(userArgs ${_pssfg_SCRIPT_ARGS})
     endif()
 
-    foreach(codegenScript ${_pssfg_SCRIPTS})
-        _pssfg_add_gen_source(
-            ${TARGET} ${codegenScript} ${outputDirectory}
+    if(_pssfg_BATCH)
+        _pssfg_add_gen_sources_batch(
+            ${TARGET} ${outputDirectory}
+            SCRIPTS ${_pssfg_SCRIPTS}
             GENERATOR_ARGS ${generatorArgs}
             USER_ARGS ${userArgs}
             DEPENDS ${_pssfg_DEPENDS}
         )
-    endforeach()
+    else()
+        foreach(codegenScript ${_pssfg_SCRIPTS})
+            _pssfg_add_gen_source(
+                ${TARGET} ${codegenScript} ${outputDirectory}
+                GENERATOR_ARGS ${generatorArgs}
+                USER_ARGS ${userArgs}
+                DEPENDS ${_pssfg_DEPENDS}
+            )
+        endforeach()
+    endif()
+
+    if(PystencilsSfg_PROFILE)
+        _pssfg_add_profile_report(
+            ${TARGET} ${outputDirectory}
+            SCRIPTS ${_pssfg_SCRIPTS}
+        )
+    endif()
 
     target_include_directories(${TARGET} PRIVATE ${_Pystencils_Include_Dir})
     
@@ -1,20 +1,32 @@
 from __future__ import annotations
 
-from typing import Sequence, TypeAlias
+from typing import Sequence, Mapping, Callable, TypeAlias
 from abc import ABC, abstractmethod
 import sympy as sp
 from functools import reduce
+from dataclasses import dataclass
 from warnings import warn
 
 from pystencils import (
     Field,
+    FieldType,
+    DEFAULTS,
     CreateKernelConfig,
     create_kernel,
     Assignment,
     AssignmentCollection,
+    TypedSymbol,
+)
+from pystencils.codegen import Kernel, GpuKernel, Lambda
+from pystencils.codegen.properties import FieldShape, FieldStride, FieldBasePtr
+from pystencils.types import (
+    create_type,
+    deconstify,
+    UserTypeSpec,
+    PsType,
+    PsPointerType,
+    PsStructType,
 )
-from pystencils.codegen import Kernel, Lambda
-from pystencils.types import create_type, UserTypeSpec, PsType
 
 from ..context import SfgContext, SfgCursor
 from .custom import CustomGenerator
@@ -58,7 +70,9 @@ from ..lang import (
     SupportsVectorExtraction,
     void,
 )
+from ..lang.cpp.std_vector import StdVector
 from ..exceptions import SfgException
+from ..generator_profile import profile_phase
 
 
 class SfgIComposer(ABC):
@@ -92,6 +106,7 @@ class KernelsAdder:
         self._kernel_namespace = knamespace
         self._inline: bool = False
         self._loc: SfgNamespaceBlock | None = None
+        self._header_loc: SfgNamespaceBlock | None = None
 
     def inline(self) -> KernelsAdder:
         """Generate kernel definitions ``inline`` in the header file."""
@@ -139,14 +154,47 @@ class KernelsAdder:
         assignments: Assignment | Sequence[Assignment] | AssignmentCollection,
         name: str | None = None,
         config: CreateKernelConfig | None = None,
+        contiguous_fast_path: bool = False,
+        int32_indexing: bool = False,
+        static_shapes: Sequence[tuple[int, ...]] = (),
     ):
         """Creates a new pystencils kernel from a list of assignments and a configuration.
         This is a wrapper around `create_kernel <pystencils.codegen.create_kernel>`
         with a subsequent call to `add`.
+
+        If ``contiguous_fast_path`` is set to `True`, a second variant of the kernel
+        named ``<name>_contiguous`` is generated, in which the innermost stride of each
+        field with a variable memory layout is fixed to one.
+        Calls to the kernel via `call <SfgBasicComposer.call>`
+        or `gpu_invoke <SfgGpuComposer.gpu_invoke>` will then check the
+        field strides at runtime and invoke the contiguous variant if it applies,
+        falling back to the fully strided kernel otherwise.
+
+        If ``int32_indexing`` is set to `True`, a second variant of the kernel
+        named ``<name>_int32`` is generated, which uses 32-bit integers for all index computations.
+        Calls to the kernel via `call <SfgBasicComposer.call>`
+        or `gpu_invoke <SfgGpuComposer.gpu_invoke>` will then check at runtime
+        that all field extents and memory offsets fit into 32 bits, and invoke the 32-bit variant
+        if they do, falling back to the kernel with the configured index type otherwise.
+        On GPUs, narrower index arithmetic reduces register pressure and may increase occupancy.
+
+        For each spatial shape listed in ``static_shapes``, e.g. ``(32, 32, 32)``,
+        a specialized variant of the kernel named ``<name>_32x32x32`` is generated,
+        in which the spatial extents of each field with a variable shape are fixed at compile time.
+        This allows the code generator to fully resolve loop bounds and index computations.
+        Calls to the kernel via `call <SfgBasicComposer.call>`
+        or `gpu_invoke <SfgGpuComposer.gpu_invoke>` will then compare the
+        field extents against each listed shape at runtime and invoke the matching specialization,
+        falling back to the generic kernel if none applies.
         """
         if config is None:
             config = CreateKernelConfig()
 
+        if sum([contiguous_fast_path, int32_indexing, bool(static_shapes)]) > 1:
+            raise ValueError(
+                "`contiguous_fast_path`, `int32_indexing` and `static_shapes` are mutually exclusive."
+            )
+
         if name is not None:
             if self._kernel_namespace.find_kernel(name) is not None:
                 raise ValueError(
@@ -156,8 +204,546 @@ class KernelsAdder:
 
             config.function_name = name
 
-        kernel = create_kernel(assignments, config=config)
-        return self.add(kernel)
+        label = f"{self._kernel_namespace.fqname}::{config.get_option('function_name')}"
+        with profile_phase("kernels.create", label):
+            contiguous_config = config.copy() if contiguous_fast_path else None
+            int32_config = config.copy() if int32_indexing else None
+            static_shape_configs = [config.copy() for _ in static_shapes]
+
+            base_config = config.copy()
+            kernel = self._create_kernel(assignments, config)
+            khandle = self.add(kernel)
+            khandle.set_assignments(_as_assignment_collection(assignments), base_config)
+            self._add_metadata(khandle)
+
+            if contiguous_config is not None:
+                self._add_contiguous_variant(khandle, assignments, contiguous_config)
+
+            if int32_config is not None:
+                int32_config.function_name = f"{khandle.name}_int32"
+                int32_config.index_dtype = "int32"
+                variant = self.add(self._create_kernel(assignments, int32_config))
+                khandle.set_int32_variant(variant)
+
+            for shape, shape_config in zip(static_shapes, static_shape_configs):
+                self._add_static_shape_variant(
+                    khandle, assignments, shape, shape_config
+                )
+
+        return khandle
+
+    def _add_contiguous_variant(
+        self,
+        khandle: SfgKernelHandle,
+        assignments: Assignment | Sequence[Assignment] | AssignmentCollection,
+        config: CreateKernelConfig,
+    ):
+        contiguous_asms, fixed_strides = _fix_innermost_strides(assignments)
+
+        if not fixed_strides:
+            raise ValueError(
+                f"Cannot create a contiguous fast path for kernel {khandle.name}: "
+                "The innermost strides of all its fields are already fixed."
+            )
+
+        strides: list[SfgKernelParamVar] = []
+        for param in khandle.parameters:
+            for prop in param.wrapped.properties:
+                match prop:
+                    case FieldStride(field, coord) if (field, coord) in fixed_strides:  # type: ignore
+                        strides.append(param)
+
+        config.function_name = f"{khandle.name}_contiguous"
+        variant = self.add(self._create_kernel(contiguous_asms, config))
+        khandle.set_contiguous_variant(variant, strides)
+
+    def _add_static_shape_variant(
+        self,
+        khandle: SfgKernelHandle,
+        assignments: Assignment | Sequence[Assignment] | AssignmentCollection,
+        shape: tuple[int, ...],
+        config: CreateKernelConfig,
+    ):
+        shape = tuple(int(s) for s in shape)
+        if any(s <= 0 for s in shape):
+            raise ValueError(f"Invalid static shape {shape}: Extents must be positive.")
+
+        static_asms, fixed_extents = _fix_spatial_shapes(assignments, shape)
+
+        if not fixed_extents:
+            raise ValueError(
+                f"Cannot specialize kernel {khandle.name} for static shape {shape}: "
+                f"It accesses no {len(shape)}-dimensional fields of variable shape."
+            )
+
+        shape_params: list[tuple[SfgKernelParamVar, int]] = []
+        for param in khandle.parameters:
+            for prop in param.wrapped.properties:
+                match prop:
+                    case FieldShape(field, coord) if (field, coord) in fixed_extents:  # type: ignore
+                        shape_params.append((param, shape[coord]))
+
+        config.function_name = f"{khandle.name}_" + "x".join(str(s) for s in shape)
+        if self._kernel_namespace.find_kernel(config.function_name) is not None:
+            raise ValueError(
+                f"Duplicate static shape {shape} given for kernel {khandle.name}"
+            )
+
+        variant = self.add(self._create_kernel(static_asms, config))
+        khandle.add_static_shape_variant(variant, shape_params)
+
+    def create_variants(
+        self,
+        assignments: Assignment | Sequence[Assignment] | AssignmentCollection,
+        name: str,
+        configs: Mapping[str, CreateKernelConfig],
+    ) -> list[SfgKernelHandle]:
+        """Creates several variants of a kernel from the same assignments,
+        one for each of the given code generator configurations.
+
+        The variant generated from ``configs[suffix]`` is named ``{name}_{suffix}``.
+        To select the best-performing variant at runtime,
+        pass the returned kernel handles to `tuned_dispatch <SfgBasicComposer.tuned_dispatch>`.
+
+        Args:
+            assignments: The kernel's assignments
+            name: Base name of the kernel variants
+            configs: Dictionary mapping variant name suffixes onto code generator configurations
+        """
+        if not configs:
+            raise ValueError("At least one kernel configuration must be given.")
+
+        return [
+            self.create(assignments, f"{name}_{suffix}", cfg)
+            for suffix, cfg in configs.items()
+        ]
+
+    def fuse(
+        self,
+        parts: Sequence[
+            SfgKernelHandle | Assignment | Sequence[Assignment] | AssignmentCollection
+        ],
+        name: str,
+        config: CreateKernelConfig | None = None,
+    ) -> SfgKernelHandle:
+        """Fuses several kernels over the same iteration space into a single kernel.
+
+        The parts are executed cell by cell in the given order;
+        instead of sweeping memory once per part, the fused kernel performs a single sweep.
+        Values written by one part and read at the same cell by a later part
+        are forwarded directly, without being reloaded from memory.
+        Subexpression symbols that are defined by more than one part,
+        or that occur as free symbols (i.e. kernel parameters) of another part, are renamed.
+
+        Each part may be a set of assignments, or the handle of a kernel previously created through
+        `create`. No part may read a field written by an earlier part or write a field read
+        by an earlier part at any neighboring cell, since the order of cell updates across
+        parts would otherwise change.
+
+        The fused kernel is generated using ``config``, or, if none is given, using the
+        configuration of the first kernel handle among the parts.
+        All parts created through `create` must agree with it in their target,
+        ghost layers, iteration slice, and index field.
+
+        Since the fused kernel accesses the union of its parts' fields,
+        all of them must be mapped using `map_field <SfgBasicComposer.map_field>` before
+        calling it, just as for any other kernel.
+
+        Args:
+            parts: The kernels or assignments that should be fused
+            name: Name of the fused kernel
+            config: Code generator configuration for the fused kernel
+        """
+        if not parts:
+            raise ValueError("At least one kernel must be given for fusion.")
+
+        collections: list[AssignmentCollection] = []
+        part_configs: list[tuple[str, CreateKernelConfig]] = []
+        for part in parts:
+            if isinstance(part, SfgKernelHandle):
+                if part.assignments is None:
+                    raise ValueError(
+                        f"Cannot fuse kernel {part.name}: Its assignments are unknown. "
+                        "Only kernels created through `sfg.kernels.create` can be fused."
+                    )
+                collections.append(part.assignments)
+                if part.config is not None:
+                    part_configs.append((part.name, part.config))
+            else:
+                collections.append(_as_assignment_collection(part))
+
+        if config is None:
+            config = (
+                part_configs[0][1].copy() if part_configs else CreateKernelConfig()
+            )
+
+        for part_name, part_config in part_configs:
+            for option in ("target", "ghost_layers", "iteration_slice", "index_field"):
+                if part_config.get_option(option) != config.get_option(option):
+                    raise ValueError(
+                        f"Cannot fuse kernel {part_name} into {name}: "
+                        f"Its code generator option `{option}` differs from the fused kernel's."
+                    )
+
+        part_free_symbols: list[set[sp.Symbol]] = [
+            {s for s in ac.free_symbols if not isinstance(s, Field.Access)}
+            for ac in collections
+        ]
+
+        part_reads: list[set[Field.Access]] = [
+            set().union(*(asm.rhs.atoms(Field.Access) for asm in ac.all_assignments))
+            for ac in collections
+        ]
+
+        fused: list[Assignment] = []
+        defined_symbols: set[sp.Symbol] = set()
+        forwarded: dict[Field.Access, sp.Expr] = dict()
+        #   Overwriting a forwarded access replaces its entry, so count temporaries separately
+        n_temporaries = 0
+        written: dict[Field, int] = dict()
+        read_offsets: dict[Field, int] = dict()
+        spatial_dims: set[int] = set()
+
+        for i, ac in enumerate(collections):
+            asms = ac.all_assignments
+
+            #   Rename subexpression symbols clashing with earlier parts,
+            #   or with free symbols of other parts
+            other_free_symbols: set[sp.Symbol] = set().union(
+                *(fs for j, fs in enumerate(part_free_symbols) if j != i)
+            )
+            renames = {
+                asm.lhs: _renamed_symbol(asm.lhs, f"{asm.lhs.name}_{i}")
+                for asm in asms
+                if not isinstance(asm.lhs, Field.Access)
+                and (asm.lhs in defined_symbols or asm.lhs in other_free_symbols)
+            }
+
+            reads = part_reads[i]
+            later_reads: set[Field.Access] = set().union(*part_reads[i + 1:])
+            part_writes = [
+                asm.lhs for asm in asms if isinstance(asm.lhs, Field.Access)
+            ]
+
+            for acc in reads | set(part_writes):
+                if not acc.is_absolute_access:
+                    spatial_dims.add(acc.field.spatial_dimensions)
+
+            for acc in reads:
+                if acc.field in written and any(o != 0 for o in acc.offsets):
+                    raise ValueError(
+                        f"Cannot fuse kernels into {name}: Field {acc.field.name} is written by part "
+                        f"{written[acc.field]} and read at a neighboring cell by part {i}."
+                    )
+            for acc in part_writes:
+                if acc.field in read_offsets:
+                    raise ValueError(
+                        f"Cannot fuse kernels into {name}: Field {acc.field.name} is read at a "
+                        f"neighboring cell by part {read_offsets[acc.field]} and written by part {i}."
+                    )
+
+            for asm in asms:
+                lhs = renames.get(asm.lhs, asm.lhs)
+                rhs = asm.rhs.xreplace(renames).xreplace(forwarded)
+
+                if isinstance(lhs, Field.Access):
+                    if lhs in later_reads:
+                        #   Keep the written value in a register for later parts
+                        tmp = TypedSymbol(
+                            f"__{lhs.field.name}_{n_temporaries}", lhs.field.dtype
+                        )
+                        n_temporaries += 1
+                        fused.append(Assignment(tmp, rhs))
+                        rhs = tmp
+                        forwarded[lhs] = tmp
+                    written.setdefault(lhs.field, i)
+                else:
+                    defined_symbols.add(lhs)
+
+                fused.append(Assignment(lhs, rhs))
+
+            for acc in reads:
+                if any(o != 0 for o in acc.offsets):
+                    read_offsets.setdefault(acc.field, i)
+
+        if len(spatial_dims) > 1:
+            raise ValueError(
+                f"Cannot fuse kernels into {name}: Their fields have different spatial dimensions."
+            )
+
+        #   Of several writes to the same field access, only the last one must be stored;
+        #   the values of earlier writes have been forwarded to later readers
+        last_writes: set[Field.Access] = set()
+        stored: list[Assignment] = []
+        for asm in reversed(fused):
+            if isinstance(asm.lhs, Field.Access):
+                if asm.lhs in last_writes:
+                    continue
+                last_writes.add(asm.lhs)
+            stored.append(asm)
+        stored.reverse()
+
+        return self.create(stored, name, config)
+
+    def create_split(
+        self,
+        assignments: Assignment | Sequence[Assignment] | AssignmentCollection,
+        name: str,
+        boundary_width: int,
+        *,
+        ghost_layers: int = 0,
+        config: CreateKernelConfig | None = None,
+    ) -> SplitKernels:
+        """Creates a kernel split up into an interior and several boundary regions.
+
+        The iteration space, which excludes ``ghost_layers`` layers at each side of the domain,
+        is partitioned into an interior kernel ``<name>_interior``, and one boundary kernel
+        ``<name>_boundary_<dir>`` per domain face, covering the outermost ``boundary_width``
+        layers of the iteration space on that side.
+        The boundary regions are disjoint; edges and corners are covered by the boundary kernel
+        of the lowest spatial coordinate they belong to.
+
+        Splitting a kernel like this permits the boundary regions, whose results depend on
+        (or are needed by) halo communication, to be scheduled separately from the interior.
+        On GPUs, use `gpu_invoke_split <SfgGpuComposer.gpu_invoke_split>` to launch
+        the interior and boundary kernels on different streams.
+
+        Args:
+            assignments: The kernel's assignments
+            name: Common prefix of the kernel names
+            boundary_width: Width of the boundary regions
+            ghost_layers: Number of ghost layers excluded from the iteration space
+            config: Code generator configuration; its ``ghost_layers`` and ``iteration_slice``
+                options are overridden
+        """
+        if boundary_width < 1:
+            raise ValueError("Boundary regions must be at least one layer wide.")
+
+        match assignments:
+            case AssignmentCollection():
+                asm_list = assignments.all_assignments
+            case Assignment():
+                asm_list = [assignments]
+            case _:
+                asm_list = list(assignments)
+
+        domain_fields = [
+            asm.lhs.field
+            for asm in asm_list
+            if isinstance(asm.lhs, Field.Access) and not asm.lhs.is_absolute_access
+        ]
+        if not domain_fields:
+            raise ValueError(
+                f"Cannot split kernel {name}: It does not write to any field."
+            )
+        domain_field = max(domain_fields, key=lambda f: f.spatial_dimensions)
+        dim = domain_field.spatial_dimensions
+
+        gls = ghost_layers
+        inner = gls + boundary_width
+
+        def upper(offset: int) -> int | None:
+            return -offset if offset > 0 else None
+
+        full = (slice(gls, upper(gls)), (True, -2 * gls))
+        interior = (slice(inner, upper(inner)), (True, -2 * inner))
+        lower_slab = (slice(gls, inner), (False, boundary_width))
+        upper_slab = (slice(-inner, upper(gls)), (False, boundary_width))
+
+        regions: list[tuple[str, list[tuple[slice, tuple[bool, int]]]]] = [
+            (f"{name}_interior", [interior] * dim)
+        ]
+        for c in range(dim):
+            for d, slab in ((-1, lower_slab), (1, upper_slab)):
+                direction = tuple(d if c2 == c else 0 for c2 in range(dim))
+                region = [interior] * c + [slab] + [full] * (dim - c - 1)
+                regions.append((f"{name}_boundary_{_direction_suffix(direction)}", region))
+
+        handles: list[SfgKernelHandle] = []
+        extents: dict[str, tuple[tuple[bool, int], ...]] = dict()
+        for kname, region in regions:
+            cfg = config.copy() if config is not None else CreateKernelConfig()
+            cfg.ghost_layers = None
+            cfg.iteration_slice = tuple(slc for slc, _ in region)
+            handles.append(self.create(assignments, kname, cfg))
+            extents[kname] = tuple(ext for _, ext in region)
+
+        return SplitKernels(
+            interior=handles[0],
+            boundary=handles[1:],
+            domain_field=domain_field,
+            extents=extents,
+        )
+
+    def create_halo_kernels(
+        self,
+        field: Field,
+        directions: Sequence[Sequence[int]],
+        name: str,
+        *,
+        ghost_layers: int = 1,
+        stencil: Sequence[Sequence[int]] | None = None,
+        config: CreateKernelConfig | None = None,
+    ) -> dict[tuple[int, ...], HaloKernels]:
+        """Creates kernels packing and unpacking the halo regions of a field
+        into and from contiguous communication buffers.
+
+        For each of the given ``directions``, two kernels are created:
+
+        - ``<name>_pack_<dir>`` copies the outermost ``ghost_layers`` slices of the field's interior
+          on the side facing ``<dir>`` into a buffer, to be sent to the neighbor in that direction;
+        - ``<name>_unpack_<dir>`` copies a buffer received from the neighbor in direction ``<dir>``
+          into the field's ghost layers on that side.
+
+        Within the buffer, the slab's values are linearized in the same order as they are laid
+        out in the field's memory, such that both kernels access the field in its natural order.
+        The buffer is represented by a one-dimensional field of the same element type,
+        named ``<name>_buffer``, which is shared by all returned kernels.
+
+        If a lattice Boltzmann ``stencil`` is given, the field's index dimension must enumerate
+        its populations. Only those populations that cross the halo face are then packed:
+        ``pack`` copies the populations whose velocity matches the direction on each of its
+        nonzero axes, and ``unpack`` those whose velocity matches the opposite direction.
+        Otherwise, all components of the field are exchanged.
+
+        Args:
+            field: The field whose halos should be exchanged
+            directions: Communication directions, given as vectors with entries in ``{-1, 0, 1}``
+            name: Common prefix of the kernel names
+            ghost_layers: Width of the halo region
+            stencil: Lattice velocities corresponding to the field's index dimension
+            config: Code generator configuration; its ``ghost_layers`` and ``iteration_slice``
+                options are overridden
+
+        Returns:
+            A dictionary mapping each direction onto its pair of pack and unpack kernels
+        """
+        if ghost_layers < 1:
+            raise ValueError("Halo regions must be at least one layer wide.")
+
+        dim = field.spatial_dimensions
+        gls = ghost_layers
+
+        components: list[tuple[int, ...]]
+        stencil_vecs: list[tuple[int, ...]] | None
+        if stencil is None:
+            components = _multi_indices(field.index_shape)
+            stencil_vecs = None
+        else:
+            if len(field.index_shape) != 1 or field.index_shape[0] != len(stencil):
+                raise ValueError(
+                    f"Field {field.name} must have exactly one index dimension of size {len(stencil)} "
+                    "to exchange the populations of the given stencil."
+                )
+            components = [(i,) for i in range(len(stencil))]
+            stencil_vecs = [tuple(int(c) for c in vec) for vec in stencil]
+
+        buffer = Field.create_generic(
+            f"{name}_buffer", 1, field.dtype, field_type=FieldType.CUSTOM
+        )
+
+        #   Order of the spatial coordinates in memory, from slowest to fastest
+        spatial_order = [c for c in field.layout if c < dim]
+        components_outermost = len(field.layout) > dim and field.layout[0] >= dim
+
+        def slab(direction: tuple[int, ...], ghost: bool):
+            slices: list[slice] = []
+            origin: list[sp.Expr] = []
+            extents: list[sp.Expr] = []
+            for c, d in enumerate(direction):
+                match d, ghost:
+                    case 0, _:
+                        slices.append(slice(gls, -gls))
+                        origin.append(sp.Integer(gls))
+                        extents.append(field.shape[c] - 2 * gls)
+                    case 1, False:
+                        slices.append(slice(-2 * gls, -gls))
+                        origin.append(field.shape[c] - 2 * gls)
+                        extents.append(sp.Integer(gls))
+                    case 1, True:
+                        slices.append(slice(-gls, None))
+                        origin.append(field.shape[c] - gls)
+                        extents.append(sp.Integer(gls))
+                    case -1, False:
+                        slices.append(slice(gls, 2 * gls))
+                        origin.append(sp.Integer(gls))
+                        extents.append(sp.Integer(gls))
+                    case -1, True:
+                        slices.append(slice(0, gls))
+                        origin.append(sp.Integer(0))
+                        extents.append(sp.Integer(gls))
+            return tuple(slices), origin, extents
+
+        def select_components(direction: tuple[int, ...]):
+            if stencil_vecs is None:
+                return components
+            return [
+                comp
+                for comp, vec in zip(components, stencil_vecs)
+                if all(vec[c] == d for c, d in enumerate(direction) if d != 0)
+            ]
+
+        def make_kernel(
+            kname: str,
+            direction: tuple[int, ...],
+            ghost: bool,
+            comps: list[tuple[int, ...]],
+        ) -> SfgKernelHandle:
+            slices, origin, extents = slab(direction, ghost)
+            counters = DEFAULTS.spatial_counters
+
+            cell_idx: sp.Expr = sp.Integer(0)
+            for c in spatial_order:
+                cell_idx = cell_idx * extents[c] + (counters[c] - origin[c])
+            num_cells = reduce(lambda a, b: a * b, extents, sp.Integer(1))
+
+            asms: list[Assignment] = []
+            for i, comp in enumerate(comps):
+                if components_outermost:
+                    buf_idx = i * num_cells + cell_idx
+                else:
+                    buf_idx = cell_idx * len(comps) + i
+                buf_acc = buffer.absolute_access((buf_idx,), ())
+                if ghost:
+                    asms.append(Assignment(field.center(*comp), buf_acc))
+                else:
+                    asms.append(Assignment(buf_acc, field.center(*comp)))
+
+            cfg = config.copy() if config is not None else CreateKernelConfig()
+            cfg.ghost_layers = None
+            cfg.iteration_slice = slices
+            return self.create(asms, kname, cfg)
+
+        result: dict[tuple[int, ...], HaloKernels] = dict()
+        for dir_spec in directions:
+            direction = tuple(int(d) for d in dir_spec)
+            if len(direction) != dim or any(d not in (-1, 0, 1) for d in direction):
+                raise ValueError(
+                    f"Invalid halo direction {dir_spec} for {dim}-dimensional field {field.name}"
+                )
+            if all(d == 0 for d in direction):
+                raise ValueError("The zero vector is not a valid halo direction.")
+
+            opposite = tuple(-d for d in direction)
+            pack_comps = select_components(direction)
+            unpack_comps = select_components(opposite)
+            if not pack_comps or not unpack_comps:
+                raise ValueError(
+                    f"No components of field {field.name} cross the halo face in direction {direction}"
+                )
+
+            suffix = _direction_suffix(direction)
+            result[direction] = HaloKernels(
+                pack=make_kernel(f"{name}_pack_{suffix}", direction, False, pack_comps),
+                unpack=make_kernel(
+                    f"{name}_unpack_{suffix}", direction, True, unpack_comps
+                ),
+                buffer=buffer,
+                pack_components=pack_comps,
+                unpack_components=unpack_comps,
+            )
+
+        return result
 
     def _get_loc(self) -> SfgNamespaceBlock:
         if self._loc is None:
@@ -171,6 +757,348 @@ class KernelsAdder:
             self._loc = kns_block
         return self._loc
 
+    def _create_kernel(
+        self,
+        assignments: Assignment | Sequence[Assignment] | AssignmentCollection,
+        config: CreateKernelConfig,
+    ) -> Kernel:
+        cache = self._cursor.context.kernel_cache
+        if cache is None:
+            return create_kernel(assignments, config=config)
+        return cache.create_kernel(_as_assignment_collection(assignments), config)
+
+    def _get_header_loc(self) -> SfgNamespaceBlock:
+        if self._inline:
+            return self._get_loc()
+
+        if self._header_loc is None:
+            self._header_loc = SfgNamespaceBlock(self._kernel_namespace)
+            self._cursor.write_header(self._header_loc)
+        return self._header_loc
+
+    def _add_metadata(self, khandle: SfgKernelHandle):
+        metadata = kernel_metadata(khandle)
+        loc = self._get_header_loc()
+        loc.elements.append(metadata.code(f"{khandle.name}_metadata", khandle.fqname))
+        self._cursor.context.header_file.includes += [
+            HeaderFile.parse("<array>"),
+            HeaderFile.parse("<cstddef>"),
+        ]
+
+
+@dataclass(frozen=True)
+class HaloKernels:
+    """Pack and unpack kernels for one halo exchange direction,
+    as created by `KernelsAdder.create_halo_kernels`."""
+
+    pack: SfgKernelHandle
+    """Kernel copying the interior slab facing the direction into the buffer"""
+
+    unpack: SfgKernelHandle
+    """Kernel copying the buffer into the ghost layers facing the direction"""
+
+    buffer: Field
+    """One-dimensional field representing the communication buffer"""
+
+    pack_components: list[tuple[int, ...]]
+    """Field components packed by `pack`, in their order in the buffer"""
+
+    unpack_components: list[tuple[int, ...]]
+    """Field components unpacked by `unpack`, in their order in the buffer"""
+
+
+@dataclass(frozen=True)
+class SplitKernels:
+    """Interior and boundary kernels of a split iteration space,
+    as created by `KernelsAdder.create_split`."""
+
+    interior: SfgKernelHandle
+    """Kernel iterating the interior region"""
+
+    boundary: list[SfgKernelHandle]
+    """Kernels iterating the boundary regions, two per spatial coordinate"""
+
+    domain_field: Field
+    """The field whose shape defines the kernels' iteration space"""
+
+    extents: dict[str, tuple[tuple[bool, int], ...]]
+    """Extents of each kernel's iteration region, indexed by kernel name.
+
+    For each spatial coordinate, the extent is given as a pair ``(relative, offset)``;
+    if ``relative`` is `True`, the extent is the domain field's shape in that coordinate
+    plus ``offset``, and otherwise just ``offset``."""
+
+    @property
+    def kernels(self) -> list[SfgKernelHandle]:
+        """All kernels, starting with the interior kernel"""
+        return [self.interior] + self.boundary
+
+
+@dataclass(frozen=True)
+class KernelMetadata:
+    """Static performance characteristics of a kernel, per cell of its iteration space,
+    as computed by `kernel_metadata`."""
+
+    rank: int
+    """Dimensionality of the kernel's iteration space"""
+
+    flops: int
+    """Number of floating point operations"""
+
+    field_traffic: tuple[tuple[str, int, int], ...]
+    """Bytes loaded and stored, as triples ``(field_name, loaded, stored)`` sorted by field name"""
+
+    @property
+    def bytes_loaded(self) -> int:
+        """Total number of bytes loaded from all fields"""
+        return sum(loaded for _, loaded, _ in self.field_traffic)
+
+    @property
+    def bytes_stored(self) -> int:
+        """Total number of bytes stored to all fields"""
+        return sum(stored for _, _, stored in self.field_traffic)
+
+    def code(self, struct_name: str, kernel_name: str) -> str:
+        """Definition of a C++ struct exposing this metadata as ``static constexpr`` members."""
+        fields = ", ".join(
+            f'{{ "{name}", {loaded}, {stored} }}'
+            for name, loaded, stored in self.field_traffic
+        )
+        return (
+            f"/** Static roofline metadata of kernel `{kernel_name}`, per iteration space cell */\n"
+            f"struct {struct_name} {{\n"
+            "  struct field_traffic { const char * field; std::size_t bytes_loaded; std::size_t bytes_stored; };\n"
+            f'  static constexpr const char * name = "{kernel_name}";\n'
+            f"  static constexpr std::size_t rank = {self.rank};\n"
+            f"  static constexpr std::size_t flops = {self.flops};\n"
+            f"  static constexpr std::size_t bytes_loaded = {self.bytes_loaded};\n"
+            f"  static constexpr std::size_t bytes_stored = {self.bytes_stored};\n"
+            f"  static constexpr std::array< field_traffic, {len(self.field_traffic)} > fields {{{{ {fields} }}}};\n"
+            "};"
+        )
+
+
+def kernel_metadata(khandle: SfgKernelHandle) -> KernelMetadata:
+    """Derive static performance metadata of a kernel from the assignments it was created from.
+
+    Floating point operations are counted on the assignments as given,
+    i.e. before any simplification by the code generator.
+    Memory traffic is estimated assuming perfect cache reuse:
+    Each distinct component of a field that is read (or written) is loaded (or stored) once per cell,
+    regardless of the number of neighbor offsets it is accessed at.
+    """
+    if khandle.assignments is None:
+        raise ValueError(
+            f"Cannot compute metadata of kernel {khandle.name}: Its assignments are unknown. "
+            "Only kernels created through `sfg.kernels.create` have metadata."
+        )
+
+    asms = khandle.assignments.all_assignments
+
+    itemsizes: dict[str, int] = dict()
+    for param in khandle.parameters:
+        for prop in param.wrapped.properties:
+            match prop:
+                case FieldBasePtr(field):  # type: ignore
+                    assert isinstance(param.dtype, PsPointerType)
+                    itemsizes[field.name] = param.dtype.base_type.itemsize
+
+    loads: dict[Field, set[tuple]] = dict()
+    stores: dict[Field, set[tuple]] = dict()
+    for asm in asms:
+        for acc in asm.rhs.atoms(Field.Access):
+            loads.setdefault(acc.field, set()).add(tuple(acc.index))
+        if isinstance(asm.lhs, Field.Access):
+            stores.setdefault(asm.lhs.field, set()).add(tuple(asm.lhs.index))
+
+    traffic: list[tuple[str, int, int]] = []
+    for field in sorted(set(loads) | set(stores), key=lambda f: f.name):
+        itemsize = itemsizes.get(field.name)
+        if itemsize is None:
+            continue
+        traffic.append(
+            (
+                field.name,
+                itemsize * len(loads.get(field, ())),
+                itemsize * len(stores.get(field, ())),
+            )
+        )
+
+    return KernelMetadata(
+        rank=max(
+            (f.spatial_dimensions for f in set(loads) | set(stores)),
+            default=0,
+        ),
+        flops=sum(_count_flops(asm.rhs) for asm in asms),
+        field_traffic=tuple(traffic),
+    )
+
+
+def int32_index_check(khandle: SfgKernelHandle) -> SfgStatements:
+    """Condition checking that the extents and the largest memory offset of each field
+    accessed by the given kernel are representable as 32-bit signed integers."""
+    params: dict[tuple[type, str, int], SfgKernelParamVar] = dict()
+    for param in khandle.parameters:
+        for prop in param.wrapped.properties:
+            match prop:
+                case FieldShape(field, coord):  # type: ignore
+                    params[(FieldShape, field.name, coord)] = param
+                case FieldStride(field, coord):  # type: ignore
+                    params[(FieldStride, field.name, coord)] = param
+
+    def entry(kind: type, field: Field, coord: int) -> str:
+        param = params.get((kind, field.name, coord))
+        if param is not None:
+            return f"int64_t( {param.name} )"
+        else:
+            entries = field.shape if kind is FieldShape else field.strides
+            return str(entries[coord])
+
+    max_value = "int64_t( std::numeric_limits< int32_t >::max() )"
+    conditions: list[str] = []
+    for field in sorted(khandle.fields, key=lambda f: f.name):
+        shapes = [entry(FieldShape, field, c) for c in range(len(field.shape))]
+        strides = [entry(FieldStride, field, c) for c in range(len(field.shape))]
+
+        conditions += [
+            f"{shape} <= {max_value}"
+            for c, shape in enumerate(shapes)
+            if (FieldShape, field.name, c) in params
+        ]
+        max_offset = " + ".join(
+            f"({shape} - 1) * std::abs( {stride} )"
+            for shape, stride in zip(shapes, strides)
+        )
+        conditions.append(f"{max_offset} <= {max_value}")
+
+    return SfgStatements(
+        " && ".join(conditions) if conditions else "true",
+        (),
+        [
+            p
+            for p in khandle.parameters
+            if any(
+                isinstance(prop, (FieldShape, FieldStride))
+                for prop in p.wrapped.properties
+            )
+        ],
+        [
+            HeaderFile.parse("<cstdint>"),
+            HeaderFile.parse("<cstdlib>"),
+            HeaderFile.parse("<limits>"),
+        ],
+    )
+
+
+def dispatch_variants(
+    khandle: SfgKernelHandle,
+    invoke: Callable[[SfgKernelHandle, SfgKernelHandle | None], SfgCallTreeNode],
+) -> SfgCallTreeNode:
+    """Invoke the given kernel, or one of its specialized variants (see `KernelsAdder.create`)
+    if the runtime check associated with that variant succeeds.
+
+    Args:
+        khandle: The kernel to be invoked
+        invoke: Callback creating an invocation of a kernel; its second argument is the kernel
+            from whose parameters the invocation's arguments should be taken, if that differs
+            from the invoked kernel.
+    """
+    if khandle.int32_variant is not None:
+        return SfgBranch(
+            int32_index_check(khandle),
+            make_sequence(invoke(khandle.int32_variant, khandle)),
+            make_sequence(invoke(khandle, None)),
+        )
+
+    if khandle.contiguous_variant is not None:
+        contiguous = " && ".join(
+            f"{stride.name} == 1" for stride in khandle.contiguity_strides
+        )
+        return SfgBranch(
+            SfgStatements(contiguous, (), khandle.contiguity_strides),
+            make_sequence(invoke(khandle.contiguous_variant, None)),
+            make_sequence(invoke(khandle, None)),
+        )
+
+    #   Build the dispatch chain back-to-front, ending in the generic kernel
+    dispatch = invoke(khandle, None)
+    for variant, shape_params in reversed(khandle.static_shape_variants):
+        matches = " && ".join(
+            f"{param.name} == {extent}" for param, extent in shape_params
+        )
+        dispatch = SfgBranch(
+            SfgStatements(matches, (), [p for p, _ in shape_params]),
+            make_sequence(invoke(variant, None)),
+            make_sequence(dispatch),
+        )
+    return dispatch
+
+
+def _as_assignment_collection(
+    assignments: Assignment | Sequence[Assignment] | AssignmentCollection,
+) -> AssignmentCollection:
+    match assignments:
+        case AssignmentCollection():
+            return assignments
+        case Assignment():
+            return AssignmentCollection([assignments])
+        case _:
+            return AssignmentCollection(list(assignments))
+
+
+def _renamed_symbol(symb: sp.Symbol, name: str) -> sp.Symbol:
+    if isinstance(symb, TypedSymbol):
+        return TypedSymbol(name, symb.dtype)
+    else:
+        return sp.Symbol(name)
+
+
+def _multi_indices(shape: tuple[int, ...]) -> list[tuple[int, ...]]:
+    indices: list[tuple[int, ...]] = [()]
+    for extent in shape:
+        indices = [idx + (i,) for idx in indices for i in range(extent)]
+    return indices
+
+
+def _direction_suffix(direction: tuple[int, ...]) -> str:
+    return "_".join(
+        f"{axis}{'p' if d > 0 else 'm'}"
+        for axis, d in zip("xyz", direction)
+        if d != 0
+    )
+
+
+def _is_reciprocal(expr: sp.Basic) -> bool:
+    return isinstance(expr, sp.Pow) and expr.exp.is_Integer and expr.exp < 0
+
+
+def _count_flops(expr: sp.Basic) -> int:
+    if not expr.args or isinstance(expr, Field.Access):
+        return 0
+
+    match expr:
+        case sp.Add():
+            ops = len(expr.args) - 1
+        case sp.Mul():
+            #   Negations are folded into additions,
+            #   and factors with negative integer exponents become divisions
+            numer = [a for a in expr.args if a != -1 and not _is_reciprocal(a)]
+            denom = [a for a in expr.args if _is_reciprocal(a)]
+            ops = max(len(numer) - 1, 0) + len(denom)
+            return (
+                ops
+                + sum(_count_flops(a) for a in numer)
+                + sum(_count_flops(sp.Pow(d.base, -d.exp)) for d in denom)
+            )
+        case sp.Pow() if expr.exp.is_Integer:
+            #   Integer powers are expanded into multiplications and a division
+            exp = int(expr.exp)
+            return abs(exp) - 1 + (exp < 0) + _count_flops(expr.base)
+        case _:
+            ops = 1
+
+    return ops + sum(_count_flops(arg) for arg in expr.args)
+
 
 class SfgBasicComposer(SfgIComposer):
     """Composer for basic source components, and base class for all composer mix-ins."""
@@ -393,10 +1321,18 @@ class SfgBasicComposer(SfgIComposer):
         To invoke a GPU kernel on a specified launch grid,
         use `gpu_invoke <SfgGpuComposer.gpu_invoke>` instead.
 
+        If the kernel was created with a contiguous fast path, a 32-bit indexing variant,
+        or static shape specializations (see `KernelsAdder.create`),
+        the generated code checks the field strides or extents at runtime
+        and calls the specialized variant of the kernel whenever possible.
+
         Args:
             kernel_handle: Handle to a kernel previously added to some kernel namespace.
         """
-        return SfgKernelCallNode(kernel_handle)
+        return dispatch_variants(
+            kernel_handle,
+            lambda khandle, args_from: SfgKernelCallNode(khandle, args_from=args_from),
+        )
 
     def seq(self, *args: tuple | str | SfgCallTreeNode | SfgNodeBuilder) -> SfgSequence:
         """Syntax sequencing. For details, see `make_sequence`"""
@@ -521,22 +1457,240 @@ class SfgBasicComposer(SfgIComposer):
         """
         return SfgSwitchBuilder(switch_arg, autobreak=autobreak)
 
+    def tuned_dispatch(
+        self,
+        variants: Sequence[SfgKernelHandle],
+        invoke: Callable[[SfgKernelHandle], SequencerArg] | None = None,
+        *,
+        tuning_runs: int = 3,
+        cache_file: ExprLike | None = None,
+    ) -> SfgCallTreeNode:
+        """Use inside a function to invoke the fastest of several kernel variants,
+        as determined by auto-tuning at runtime.
+
+        The tuning key of an invocation is made up of the shapes and strides
+        of all fields accessed by the kernel variants.
+        When the dispatcher encounters a new tuning key, it runs a short tuning sweep,
+        invoking each variant ``tuning_runs`` times and measuring its runtime.
+        The fastest variant is remembered for that key and invoked from then on.
+
+        If ``cache_file`` is given, the tuning results are additionally persisted to that file,
+        and read back from it when the dispatcher is first used;
+        later runs of the program therefore start out tuned.
+
+        :Example:
+
+            .. code-block:: Python
+
+                variants = sfg.kernels.create_variants(asm, "scale", {
+                    "linear3d": cfg_linear3d,
+                    "blockwise4d": cfg_blockwise4d,
+                })
+
+                sfg.function("scale")(
+                    sfg.map_field(f, ...),
+                    sfg.map_field(g, ...),
+                    sfg.tuned_dispatch(
+                        variants,
+                        lambda khandle: sfg.gpu_invoke(khandle, stream=stream),
+                        cache_file='"scale.tuning"',
+                    ),
+                )
+
+        During tuning, all variants are executed several times on the same input data.
+        The dispatched kernels must therefore not update any of their fields in place.
+
+        Args:
+            variants: Handles to the kernel variants, e.g. as returned by
+                `create_variants <KernelsAdder.create_variants>`
+            invoke: Callback producing the invocation code of a kernel variant.
+                Defaults to `call` for CPU kernels and to
+                `gpu_invoke <SfgGpuComposer.gpu_invoke>` for GPU kernels.
+            tuning_runs: Number of timed invocations per variant during tuning
+            cache_file: Optional expression evaluating to the path of the tuning cache file
+        """
+        if invoke is None:
+            from .composer import SfgComposer
+
+            sfg = SfgComposer(self)
+
+            def default_invoke(khandle: SfgKernelHandle) -> SequencerArg:
+                if isinstance(khandle.kernel, GpuKernel):
+                    return sfg.gpu_invoke(khandle)
+                else:
+                    return sfg.call(khandle)
+
+            invoke = default_invoke
+
+        return SfgTunedDispatchBuilder(
+            variants, invoke, tuning_runs=tuning_runs, cache_file=cache_file
+        ).resolve()
+
+    def temporal_blocking(
+        self,
+        kernel_handle: SfgKernelHandle,
+        iterations: ExprLike,
+        swap: tuple[Field, Field],
+        *,
+        ghost_layers: int | None = None,
+        time_block: int = 4,
+        tile_size: int | None = None,
+    ) -> SfgCallTreeNode:
+        """Use inside a function to run several sweeps of a stencil kernel with temporal blocking.
+
+        The result is equivalent to calling the kernel ``iterations`` times,
+        swapping the two fields in ``swap`` after each sweep,
+        such that the final result resides in ``swap[1]`` if ``iterations`` is odd,
+        and in ``swap[0]`` otherwise.
+        Instead of sweeping the entire domain once per iteration, however, the generated code
+        splits the slowest spatial coordinate into tiles,
+        and advances each tile by up to ``time_block`` iterations at once.
+        The tiles are skewed by the stencil radius in each time step (wavefront tiling),
+        such that the data of a tile stays in cache across those iterations.
+
+        The kernel is called on views of the fields restricted to the current tile;
+        its fields must therefore be mapped beforehand using `map_field`, just as for `call`.
+        Both fields in ``swap`` must have the same shape and strides,
+        and their ghost layers must hold the boundary values before the first sweep.
+        Since both fields are written to, they must be mapped from mutable objects,
+        even if the kernel only reads ``swap[0]``.
+
+        Args:
+            kernel_handle: The stencil kernel, reading from ``swap[0]`` and writing to ``swap[1]``
+            iterations: Number of sweeps to perform
+            swap: Pair of source and destination fields that are swapped after each sweep
+            ghost_layers: Number of ghost layers of the kernel's iteration space;
+                defaults to the stencil radius
+            time_block: Number of iterations each tile is advanced by at once
+            tile_size: Width of the tiles along the blocked coordinate;
+                chosen from the stencil radius and ``time_block`` if not specified
+        """
+        return SfgTemporalBlockingBuilder(
+            kernel_handle,
+            iterations,
+            swap,
+            ghost_layers=ghost_layers,
+            time_block=time_block,
+            tile_size=tile_size,
+        ).resolve()
+
+    def benchmark(
+        self,
+        kernel_handle: SfgKernelHandle,
+        shape: Sequence[ExprLike | int],
+        *,
+        repetitions: ExprLike | int = 10,
+        warmup: ExprLike | int = 1,
+        out: ExprLike | None = None,
+    ) -> SfgCallTreeNode:
+        """Use inside a function to generate a micro-benchmark driver for a host kernel.
+
+        The driver allocates a buffer of the given spatial ``shape`` for each field accessed
+        by the kernel, laid out according to that field's memory layout, and uses it as the field's data.
+        Scalar kernel parameters are set to one.
+        It then calls the kernel ``warmup`` times without timing,
+        and measures the total run time of ``repetitions`` further calls.
+        Finally, it writes a single line of JSON to the output stream ``out`` (default: ``std::cout``),
+        reporting the kernel name, shape, number of repetitions, run time in seconds, and
+        the achieved throughput in million lattice updates per second (``mlups``),
+        memory bandwidth (``gbytes_per_second``) and compute rate (``gflops_per_second``).
+        The bandwidth and compute rate are computed from the kernel's `kernel_metadata`,
+        and the number of lattice updates from the number of cells in the kernel's iteration space
+        (i.e. ``shape`` without the kernel's ghost layers, or restricted to its iteration slice),
+        which is also reported as ``cells``.
+
+        Since the benchmark derives the kernel's memory traffic from its assignments,
+        only kernels created through `kernels.create <KernelsAdder.create>` can be benchmarked.
+
+        Args:
+            kernel_handle: The kernel to benchmark
+            shape: Spatial extents of the fields; one entry per spatial coordinate
+            repetitions: Number of timed kernel calls
+            warmup: Number of kernel calls before timing starts
+            out: Output stream the results are written to
+        """
+        return SfgBenchmarkBuilder(
+            kernel_handle, shape, repetitions=repetitions, warmup=warmup, out=out
+        ).resolve()
+
     def map_field(
         self,
         field: Field,
         index_provider: SupportsFieldExtraction,
         cast_indexing_symbols: bool = True,
+        alignment: int | None = None,
+        check_alignment: bool = False,
     ) -> SfgDeferredFieldMapping:
         """Map a pystencils field to a field data structure, from which pointers, sizes
         and strides should be extracted.
 
+        If ``alignment`` is given, the extracted base pointer is marked with ``std::assume_aligned``.
+        To also have the kernel emit aligned SIMD loads and stores, generate it with the
+        `cpu.vectorize.assume_aligned <pystencils.codegen.config.VectorizationOptions.assume_aligned>`
+        option enabled.
+
+        The index fields of sparse kernels, as created by `index_field <SfgClassComposer.index_field>`,
+        are mapped like any one-dimensional field, e.g. onto an ``std::vector`` or ``std::span``
+        of their struct type.
+
         Args:
             field: The pystencils field to be mapped
             index_provider: An object that provides the field indexing information
             cast_indexing_symbols: Whether to always introduce explicit casts for indexing symbols
+            alignment: Guaranteed alignment of the field's base pointer in bytes
+            check_alignment: If `True`, emit an ``assert`` checking the base pointer's alignment
+                in debug builds
         """
+        if isinstance(field.dtype, PsStructType) and field.dtype.anonymous:
+            raise ValueError(
+                f"Cannot map field {field} with anonymous struct element type. "
+                "Create index fields for sparse kernels using `sfg.index_field` instead."
+            )
+
         return SfgDeferredFieldMapping(
-            field, index_provider, cast_indexing_symbols=cast_indexing_symbols
+            field,
+            index_provider,
+            cast_indexing_symbols=cast_indexing_symbols,
+            alignment=alignment,
+            check_alignment=check_alignment,
+        )
+
+    def aligned_vector(
+        self,
+        T: UserTypeSpec,
+        alignment: int,
+        *,
+        ref: bool = False,
+        const: bool = False,
+    ) -> StdVector:
+        """Create an ``std::vector`` type whose data is aligned to ``alignment`` bytes.
+
+        The vector uses an allocator based on the aligned ``operator new`` of C++17,
+        whose definition is emitted into the generated header file.
+        Fields mapped onto such vectors have their base pointers marked with ``std::assume_aligned``.
+
+        Args:
+            T: Element type of the vector
+            alignment: Alignment of the vector's data in bytes; must be a power of two
+            ref: If `True`, model a reference to the vector
+            const: If `True`, model a ``const`` vector
+        """
+        if alignment <= 0 or alignment & (alignment - 1) != 0:
+            raise ValueError(f"Alignment must be a positive power of two: {alignment}")
+
+        header = self._ctx.header_file
+        definition = StdVector.aligned_allocator_definition()
+        if definition not in header.elements:
+            #   Place the allocator in the global namespace, ahead of all generated code
+            header.elements.insert(0, definition)
+            header.includes += [HeaderFile.parse(h) for h in ("<cstddef>", "<new>")]
+
+        return StdVector(
+            T,
+            ref=ref,
+            const=const,
+            allocator=StdVector.aligned_allocator(T, alignment),
+            alignment=alignment,
         )
 
     def set_param(self, param: VarLike | sp.Symbol, expr: ExprLike):
@@ -566,6 +1720,239 @@ class SfgBasicComposer(SfgIComposer):
         return SfgDeferredVectorMapping(components, rhs)
 
 
+def _replace_fields(
+    assignments: Assignment | Sequence[Assignment] | AssignmentCollection,
+    replace: Callable[[Field], Field | None],
+) -> tuple[Assignment | list[Assignment] | AssignmentCollection, set[Field]]:
+    """Replace the fields accessed by the given assignments.
+
+    For each field, ``replace`` returns either its replacement or `None`
+    if the field should be kept.
+
+    Returns:
+        The transformed assignments, and the set of all original fields that were replaced.
+    """
+    asm_list: list[Assignment]
+    match assignments:
+        case AssignmentCollection():
+            asm_list = assignments.all_assignments
+        case Assignment():
+            asm_list = [assignments]
+        case _:
+            asm_list = list(assignments)
+
+    accesses: set[Field.Access] = set().union(
+        *(asm.atoms(Field.Access) for asm in asm_list)
+    )
+
+    replacement_fields: dict[Field, Field] = dict()
+    for field in set(acc.field for acc in accesses):
+        replacement = replace(field)
+        if replacement is not None:
+            replacement_fields[field] = replacement
+
+    subs = {
+        acc: Field.Access(
+            replacement_fields[acc.field],
+            acc.offsets,
+            acc.index,
+            is_absolute_access=acc.is_absolute_access,
+            dtype=acc.dtype,
+        )
+        for acc in accesses
+        if acc.field in replacement_fields
+    }
+
+    replaced = set(replacement_fields.keys())
+
+    match assignments:
+        case AssignmentCollection():
+            return (
+                assignments.copy(
+                    main_assignments=[
+                        asm.xreplace(subs) for asm in assignments.main_assignments
+                    ],
+                    subexpressions=[
+                        asm.xreplace(subs) for asm in assignments.subexpressions
+                    ],
+                ),
+                replaced,
+            )
+        case Assignment():
+            return assignments.xreplace(subs), replaced
+        case _:
+            return [asm.xreplace(subs) for asm in asm_list], replaced
+
+
+def _fix_innermost_strides(
+    assignments: Assignment | Sequence[Assignment] | AssignmentCollection,
+) -> tuple[
+    Assignment | list[Assignment] | AssignmentCollection, set[tuple[Field, int]]
+]:
+    """Replace each field accessed by the given assignments by a copy
+    whose innermost stride is fixed to one.
+
+    Returns:
+        The transformed assignments, and the set of ``(field, coordinate)`` pairs
+        of all strides that were fixed.
+    """
+
+    def fix_stride(field: Field) -> Field | None:
+        inner_coord = field.layout[-1]
+        if isinstance(field.strides[inner_coord], sp.Integer):
+            return None
+
+        strides = list(field.strides)
+        strides[inner_coord] = sp.Integer(1)
+        return Field(
+            field.name,
+            field.field_type,
+            field.dtype,
+            field.layout,
+            field.shape,
+            tuple(strides),
+        )
+
+    asms, replaced = _replace_fields(assignments, fix_stride)
+    return asms, {(field, field.layout[-1]) for field in replaced}
+
+
+def _fix_spatial_shapes(
+    assignments: Assignment | Sequence[Assignment] | AssignmentCollection,
+    spatial_shape: tuple[int, ...],
+) -> tuple[
+    Assignment | list[Assignment] | AssignmentCollection, set[tuple[Field, int]]
+]:
+    """Replace each variable-shape field accessed by the given assignments by a copy
+    whose spatial shape is fixed to ``spatial_shape``.
+
+    Returns:
+        The transformed assignments, and the set of ``(field, coordinate)`` pairs
+        of all shape entries that were fixed.
+    """
+
+    def fix_shape(field: Field) -> Field | None:
+        if field.spatial_dimensions != len(spatial_shape):
+            return None
+
+        shape = list(field.shape)
+        fixed = False
+        for c, extent in enumerate(spatial_shape):
+            if not isinstance(shape[c], sp.Integer):
+                shape[c] = sp.Integer(extent)
+                fixed = True
+
+        if not fixed:
+            return None
+
+        return Field(
+            field.name,
+            field.field_type,
+            field.dtype,
+            field.layout,
+            tuple(shape),
+            field.strides,
+        )
+
+    asms, replaced = _replace_fields(assignments, fix_shape)
+    return asms, {
+        (field, c)
+        for field in replaced
+        for c in range(field.spatial_dimensions)
+        if not isinstance(field.shape[c], sp.Integer)
+    }
+
+
+def _schedule_omp_tasks(tree: SfgSequence) -> SfgSequence:
+    """Wrap runs of consecutive kernel calls in the given sequence into OpenMP task regions."""
+
+    def kernel_calls(node: SfgCallTreeNode) -> list[SfgKernelHandle] | None:
+        """If ``node`` does nothing but call host kernels, return these kernels.
+
+        Arbitrary statements may have side effects the task dependencies do not capture,
+        so they are never considered part of a kernel call."""
+        match node:
+            case SfgKernelCallNode():
+                return [node.kernel_handle]
+            case SfgBranch():
+                #   Branch conditions are assumed to be free of side effects
+                branches = [node.branch_true]
+                if node.branch_false is not None:
+                    branches.append(node.branch_false)
+                handles: list[SfgKernelHandle] = []
+                for b in branches:
+                    branch_handles = kernel_calls(b)
+                    if branch_handles is None:
+                        return None
+                    handles += branch_handles
+                return handles
+            case SfgSequence() | SfgBlock():
+                handles = []
+                for c in node.children:
+                    child_handles = kernel_calls(c)
+                    if child_handles is None:
+                        return None
+                    handles += child_handles
+                return handles
+            case _:
+                return None
+
+    def depend_clauses(handles: list[SfgKernelHandle]) -> str:
+        reads: dict[str, str] = dict()
+        writes: dict[str, str] = dict()
+        for khandle in handles:
+            for param in khandle.parameters:
+                for prop in param.wrapped.properties:
+                    if isinstance(prop, FieldBasePtr):
+                        item = f"{param.name}[0]"
+                        dtype = param.dtype
+                        if isinstance(dtype, PsPointerType) and not dtype.base_type.const:
+                            writes[prop.field.name] = item
+                        else:
+                            reads[prop.field.name] = item
+
+        clauses = []
+        ins = [item for fname, item in reads.items() if fname not in writes]
+        if ins:
+            clauses.append(f"depend(in: {', '.join(ins)})")
+        if writes:
+            clauses.append(f"depend(inout: {', '.join(writes.values())})")
+        return " ".join(clauses)
+
+    def task_region(run: list[tuple[SfgCallTreeNode, list[SfgKernelHandle]]]):
+        tasks: list[SfgCallTreeNode] = []
+        for node, handles in run:
+            pragma = " ".join(["#pragma omp task", depend_clauses(handles)]).rstrip()
+            body = node if isinstance(node, SfgBlock) else SfgBlock(SfgSequence([node]))
+            tasks += [SfgStatements(pragma, (), ()), body]
+
+        return [
+            SfgStatements("#pragma omp parallel\n#pragma omp single", (), ()),
+            SfgBlock(SfgSequence(tasks)),
+        ]
+
+    children: list[SfgCallTreeNode] = []
+    run: list[tuple[SfgCallTreeNode, list[SfgKernelHandle]]] = []
+
+    def flush():
+        if len(run) > 1:
+            children.extend(task_region(run))
+        else:
+            children.extend(node for node, _ in run)
+        run.clear()
+
+    for child in tree.children:
+        handles = kernel_calls(child)
+        if handles:
+            run.append((child, handles))
+        else:
+            flush()
+            children.append(child)
+    flush()
+
+    return SfgSequence(children)
+
+
 def make_statements(arg: ExprLike) -> SfgStatements:
     return SfgStatements(str(arg), (), depends(arg), includes(arg))
 
@@ -666,6 +2053,9 @@ class SfgFunctionSequencerBase:
         #   Attributes
         self._attributes: list[str] = []
 
+        #   Scheduling
+        self._omp_tasks: bool = False
+
     def returns(self, rtype: UserTypeSpec):
         """Set the return type of the function"""
         self._return_type = create_type(rtype)
@@ -697,6 +2087,23 @@ class SfgFunctionSequencerBase:
         self._attributes += attrs
         return self
 
+    def omp_tasks(self):
+        """Run independent kernel calls in the body concurrently using OpenMP tasks.
+
+        Each maximal run of consecutive kernel calls (see `sfg.call <SfgBasicComposer.call>`)
+        in the top-level sequence of the body is placed inside an OpenMP ``parallel`` region,
+        with one task per call.
+        The tasks are ordered through ``depend`` clauses on the fields' data pointers,
+        such that calls accessing a common field, of which at least one writes it,
+        still run in their original order.
+        All other statements of the body act as barriers between runs of tasks.
+
+        The generated code must be compiled with OpenMP enabled;
+        otherwise, the pragmas are ignored and the kernels run sequentially.
+        """
+        self._omp_tasks = True
+        return self
+
 
 class SfgFunctionSequencer(SfgFunctionSequencerBase):
     """Sequencer for constructing functions."""
@@ -704,6 +2111,8 @@ class SfgFunctionSequencer(SfgFunctionSequencerBase):
     def __call__(self, *args: SequencerArg) -> None:
         """Populate the function body"""
         tree = make_sequence(*args)
+        if self._omp_tasks:
+            tree = _schedule_omp_tasks(tree)
         func = SfgFunction(
             self._name,
             self._cursor.current_namespace,
@@ -799,3 +2208,618 @@ class SfgSwitchBuilder(SfgNodeBuilder):
 
     def resolve(self) -> SfgCallTreeNode:
         return SfgSwitch(make_statements(self._switch_arg), self._cases, self._default)
+
+
+class SfgTunedDispatchBuilder(SfgNodeBuilder):
+    """Builder for auto-tuning kernel variant dispatchers."""
+
+    def __init__(
+        self,
+        variants: Sequence[SfgKernelHandle],
+        invoke: Callable[[SfgKernelHandle], SequencerArg],
+        tuning_runs: int = 3,
+        cache_file: ExprLike | None = None,
+    ):
+        if not variants:
+            raise ValueError("At least one kernel variant must be given.")
+
+        if tuning_runs < 1:
+            raise ValueError("`tuning_runs` must be positive.")
+
+        self._variants = list(variants)
+        self._invoke = invoke
+        self._tuning_runs = tuning_runs
+        self._cache_file = cache_file
+
+    def _key_variables(self) -> list[SfgVar]:
+        key_vars: dict[str, SfgVar] = dict()
+        for khandle in self._variants:
+            for param in khandle.parameters:
+                if any(
+                    isinstance(prop, (FieldShape, FieldStride))
+                    for prop in param.wrapped.properties
+                ):
+                    key_vars[param.name] = param
+        return sorted(key_vars.values(), key=lambda v: v.name)
+
+    def _synchronize(self) -> tuple[SequencerArg, ...]:
+        gpu_kernels = [
+            kh.kernel for kh in self._variants if isinstance(kh.kernel, GpuKernel)
+        ]
+        if not gpu_kernels:
+            return ()
+
+        from pystencils import Target
+        from ..lang.gpu import CudaAPI, HipAPI
+
+        api = CudaAPI if gpu_kernels[0].target == Target.CUDA else HipAPI
+        return (AugExpr.format("{};", api.device_synchronize()),)
+
+    def _tuning_sweep(self) -> SfgSequence:
+        sync = self._synchronize()
+        nodes: list[SequencerArg] = [
+            "std::size_t __best_variant { 0 };",
+            "double __best_time { std::numeric_limits< double >::infinity() };",
+        ]
+
+        for i, khandle in enumerate(self._variants):
+            nodes.append(
+                (
+                    f"/* Variant {i}: {khandle.name} */",
+                    self._invoke(khandle),
+                    *sync,
+                    "const auto __tuning_start = std::chrono::steady_clock::now();",
+                    f"for(int __rep = 0; __rep < {self._tuning_runs}; ++__rep)",
+                    (self._invoke(khandle),),
+                    *sync,
+                    "const std::chrono::duration< double > __elapsed = "
+                    "std::chrono::steady_clock::now() - __tuning_start;",
+                    "if(__elapsed.count() < __best_time) {\n"
+                    "  __best_time = __elapsed.count();\n"
+                    f"  __best_variant = {i};\n"
+                    "}",
+                )
+            )
+
+        nodes.append(
+            "__tuned_it = __tuned_variants.emplace(__tuning_key, __best_variant).first;"
+        )
+
+        if self._cache_file is not None:
+            nodes.append(
+                AugExpr.format(
+                    "std::ofstream __tuning_cache {{ {}, std::ios::app }};\n"
+                    "for(const auto __k : __tuning_key) {{\n"
+                    '  __tuning_cache << __k << " ";\n'
+                    "}}\n"
+                    '__tuning_cache << __variant_names[__best_variant] << "\\n";',
+                    self._cache_file,
+                )
+            )
+
+        return make_sequence(*nodes)
+
+    def _load_cache(self) -> AugExpr:
+        return AugExpr.format(
+            "[&]() {{\n"
+            "  std::map< __tuning_key_t, std::size_t > __entries;\n"
+            "  std::ifstream __tuning_cache {{ {} }};\n"
+            "  std::string __line;\n"
+            "  while(std::getline(__tuning_cache, __line)) {{\n"
+            "    std::istringstream __entry {{ __line }};\n"
+            "    __tuning_key_t __key;\n"
+            "    std::string __name;\n"
+            "    for(auto & __k : __key) {{\n"
+            "      __entry >> __k;\n"
+            "    }}\n"
+            "    __entry >> __name;\n"
+            "    for(std::size_t __i = 0; __entry && __i < __variant_names.size(); ++__i) {{\n"
+            "      if(__variant_names[__i] == __name) {{\n"
+            "        __entries[__key] = __i;\n"
+            "      }}\n"
+            "    }}\n"
+            "  }}\n"
+            "  return __entries;\n"
+            "}}()",
+            self._cache_file,
+        )
+
+    def resolve(self) -> SfgCallTreeNode:
+        key_vars = self._key_variables()
+        n_variants = len(self._variants)
+
+        variant_names = ", ".join(f'"{kh.name}"' for kh in self._variants)
+        tuned_variants_init = (
+            f" = {self._load_cache()}" if self._cache_file is not None else ""
+        )
+        key_entries = ", ".join(f"int64_t({v.name})" for v in key_vars)
+
+        headers = [
+            "<array>",
+            "<map>",
+            "<string_view>",
+            "<chrono>",
+            "<limits>",
+            "<cstdint>",
+        ]
+        if self._cache_file is not None:
+            headers += ["<fstream>", "<sstream>", "<string>"]
+
+        setup = SfgStatements(
+            f"static constexpr std::array< std::string_view, {n_variants} > "
+            f"__variant_names {{ {variant_names} }};\n"
+            f"using __tuning_key_t = std::array< int64_t, {len(key_vars)} >;\n"
+            f"static std::map< __tuning_key_t, std::size_t > __tuned_variants{tuned_variants_init};\n"
+            f"const __tuning_key_t __tuning_key {{ {key_entries} }};\n"
+            "auto __tuned_it = __tuned_variants.find(__tuning_key);",
+            (),
+            key_vars
+            + (list(depends(self._cache_file)) if self._cache_file is not None else []),
+            [HeaderFile.parse(h) for h in headers]
+            + (list(includes(self._cache_file)) if self._cache_file is not None else []),
+        )
+
+        tuning = SfgBranch(
+            make_statements("__tuned_it == __tuned_variants.end()"),
+            self._tuning_sweep(),
+        )
+
+        dispatch = SfgSwitch(
+            make_statements("__tuned_it->second"),
+            {
+                str(i): make_sequence(self._invoke(khandle), "break;")
+                for i, khandle in enumerate(self._variants)
+            },
+        )
+
+        return SfgBlock(make_sequence(setup, tuning, dispatch))
+
+
+class SfgTemporalBlockingBuilder(SfgNodeBuilder):
+    """Builder for temporally blocked stencil sweeps."""
+
+    def __init__(
+        self,
+        kernel_handle: SfgKernelHandle,
+        iterations: ExprLike,
+        swap: tuple[Field, Field],
+        *,
+        ghost_layers: int | None = None,
+        time_block: int = 4,
+        tile_size: int | None = None,
+    ):
+        if isinstance(kernel_handle.kernel, GpuKernel):
+            raise ValueError("Temporal blocking is only supported for host kernels.")
+
+        if time_block < 1:
+            raise ValueError("`time_block` must be positive.")
+
+        src, dst = swap
+        if kernel_handle.assignments is None:
+            raise ValueError(
+                f"Cannot determine the stencil radius of kernel {kernel_handle.name}: "
+                "Its assignments are unknown."
+            )
+
+        accesses = set().union(
+            *(
+                asm.rhs.atoms(Field.Access)
+                for asm in kernel_handle.assignments.all_assignments
+            )
+        )
+        offsets = [
+            abs(int(o))
+            for acc in accesses
+            if acc.field == src and not acc.is_absolute_access
+            for o in acc.offsets
+        ]
+        if not offsets:
+            raise ValueError(
+                f"Kernel {kernel_handle.name} does not read from field {src.name}."
+            )
+        radius = max(max(offsets), 1)
+
+        fields = kernel_handle.fields
+        if src not in fields or dst not in fields:
+            raise ValueError(
+                f"Kernel {kernel_handle.name} must access both {src.name} and {dst.name}."
+            )
+
+        self._khandle = kernel_handle
+        self._iterations = iterations
+        self._src = src
+        self._dst = dst
+        self._radius = radius
+        self._ghost_layers = ghost_layers if ghost_layers is not None else radius
+        self._time_block = time_block
+        self._tile_size = (
+            tile_size if tile_size is not None else max(16, 4 * radius * time_block)
+        )
+
+        if self._tile_size < 2 * radius:
+            raise ValueError(
+                f"`tile_size` must be at least twice the stencil radius ({2 * radius})."
+            )
+
+        #   Block along the slowest spatial coordinate of the destination field
+        dim = dst.spatial_dimensions
+        self._coord = [c for c in dst.layout if c < dim][0]
+
+        self._params: dict[tuple[type, str, int | None], SfgKernelParamVar] = dict()
+        for param in kernel_handle.parameters:
+            for prop in param.wrapped.properties:
+                match prop:
+                    case FieldBasePtr(field):  # type: ignore
+                        self._params[(FieldBasePtr, field.name, None)] = param
+                    case FieldShape(field, coord):  # type: ignore
+                        self._params[(FieldShape, field.name, coord)] = param
+                    case FieldStride(field, coord):  # type: ignore
+                        self._params[(FieldStride, field.name, coord)] = param
+
+        for field in fields:
+            if isinstance(field.shape[self._coord], sp.Integer):
+                raise ValueError(
+                    f"Cannot apply temporal blocking to fixed-shape field {field.name}"
+                )
+
+    def _stride(self, field: Field) -> str:
+        stride = field.strides[self._coord]
+        if isinstance(stride, sp.Integer):
+            return str(int(stride))
+        return self._params[(FieldStride, field.name, self._coord)].name
+
+    @staticmethod
+    def _pingpong_ptr(field_name: str) -> str:
+        return f"__tb_data_{field_name}"
+
+    def _pingpong_setup(self) -> SfgStatements:
+        """Declare mutable data pointers of both ping-pong fields.
+
+        The kernel only reads the source field, so its data pointer parameter
+        (and thus the mapped variable) is ``const``-qualified;
+        on swapped steps, however, the source field is passed as the kernel's destination."""
+        decls: list[str] = []
+        data_params: list[SfgKernelParamVar] = []
+        for field in (self._src, self._dst):
+            param = self._params[(FieldBasePtr, field.name, None)]
+            dtype = deconstify(field.dtype).c_string()
+            decls.append(
+                f"{dtype} * {self._pingpong_ptr(field.name)} "
+                f"{{ const_cast< {dtype} * >({param.name}) }};"
+            )
+            data_params.append(param)
+
+        return SfgStatements("\n".join(decls), (), data_params)
+
+    def _tile_call(self, swapped: bool) -> SfgStatements:
+        """Call the kernel on views of its fields restricted to the current tile."""
+        gls = self._ghost_layers
+        renamed = {self._src.name: self._dst.name, self._dst.name: self._src.name}
+
+        args: list[str] = []
+        for param in self._khandle.parameters:
+            arg = param.name
+            for prop in param.wrapped.properties:
+                match prop:
+                    case FieldBasePtr(field):  # type: ignore
+                        data_field = (
+                            renamed.get(field.name, field.name) if swapped else field.name
+                        )
+                        if data_field in renamed:
+                            data = self._pingpong_ptr(data_field)
+                        else:
+                            data = self._params[(FieldBasePtr, data_field, None)].name
+                        arg = f"{data} + (__tb_begin - {gls}) * {self._stride(field)}"
+                    case FieldShape(_, coord) if coord == self._coord:  # type: ignore
+                        arg = f"__tb_end - __tb_begin + {2 * gls}"
+            args.append(arg)
+
+        return SfgStatements(
+            f"{self._khandle.fqname}({', '.join(args)});",
+            (),
+            self._khandle.parameters,
+        )
+
+    def resolve(self) -> SfgCallTreeNode:
+        gls = self._ghost_layers
+        rad = self._radius
+        tile = self._tile_size
+        size = self._params[(FieldShape, self._dst.name, self._coord)]
+
+        setup = SfgStatements(
+            f"const int64_t __tb_steps {{ int64_t({self._iterations}) }};\n"
+            f"const int64_t __tb_lo {{ {gls} }};\n"
+            f"const int64_t __tb_hi {{ int64_t({size.name}) - {gls} }};",
+            (),
+            [size] + list(depends(self._iterations)),
+            [HeaderFile.parse("<cstdint>"), HeaderFile.parse("<algorithm>")]
+            + list(includes(self._iterations)),
+        )
+
+        return SfgBlock(
+            make_sequence(
+                setup,
+                self._pingpong_setup(),
+                f"for(int64_t __tb_t0 = 0; __tb_t0 < __tb_steps; __tb_t0 += {self._time_block})",
+                (
+                    "const int64_t __tb_nt { "
+                    f"std::min< int64_t >({self._time_block}, __tb_steps - __tb_t0) }};",
+                    "const int64_t __tb_num_tiles { "
+                    f"(__tb_hi - __tb_lo + (__tb_nt - 1) * {rad} + {tile - 1}) / {tile} }};",
+                    "for(int64_t __tb_b = 0; __tb_b < __tb_num_tiles; ++__tb_b)",
+                    (
+                        "for(int64_t __tb_t = 0; __tb_t < __tb_nt; ++__tb_t)",
+                        (
+                            "const int64_t __tb_begin { std::max< int64_t >(__tb_lo, "
+                            f"__tb_lo + __tb_b * {tile} - __tb_t * {rad}) }};",
+                            "const int64_t __tb_end { std::min< int64_t >(__tb_hi, "
+                            f"__tb_lo + (__tb_b + 1) * {tile} - __tb_t * {rad}) }};",
+                            "if(__tb_begin >= __tb_end) continue;",
+                            SfgBranch(
+                                make_statements("(__tb_t0 + __tb_t) % 2 == 0"),
+                                make_sequence(self._tile_call(swapped=False)),
+                                make_sequence(self._tile_call(swapped=True)),
+                            ),
+                        ),
+                    ),
+                ),
+            )
+        )
+
+
+class SfgBenchmarkBuilder(SfgNodeBuilder):
+    """Builder for micro-benchmark drivers of host kernels."""
+
+    def __init__(
+        self,
+        kernel_handle: SfgKernelHandle,
+        shape: Sequence[ExprLike | int],
+        *,
+        repetitions: ExprLike | int = 10,
+        warmup: ExprLike | int = 1,
+        out: ExprLike | None = None,
+    ):
+        if isinstance(kernel_handle.kernel, GpuKernel):
+            raise ValueError("Benchmark drivers are only supported for host kernels.")
+
+        metadata = kernel_metadata(kernel_handle)
+        if len(shape) != metadata.rank:
+            raise ValueError(
+                f"Kernel {kernel_handle.name} has a {metadata.rank}-dimensional iteration space, "
+                f"but {len(shape)} extents were given."
+            )
+
+        for field in kernel_handle.fields:
+            if field.spatial_dimensions != metadata.rank:
+                raise ValueError(
+                    f"Cannot benchmark kernel {kernel_handle.name}: "
+                    "Its fields have different spatial dimensions."
+                )
+            if not all(sp.sympify(s).is_Integer for s in field.index_shape):
+                raise ValueError(
+                    f"Cannot benchmark kernel {kernel_handle.name}: "
+                    f"The index shape of field {field.name} is not fixed."
+                )
+
+        config = kernel_handle.config
+        if config is not None and config.get_option("index_field") is not None:
+            raise ValueError(
+                f"Cannot benchmark kernel {kernel_handle.name}: "
+                "Kernels with index fields are not supported."
+            )
+
+        def expr(e: ExprLike | int) -> ExprLike:
+            return str(e) if isinstance(e, int) else e
+
+        self._khandle = kernel_handle
+        self._metadata = metadata
+        self._shape = [expr(s) for s in shape]
+        self._repetitions = expr(repetitions)
+        self._warmup = expr(warmup)
+        self._out = out
+
+    def _field_extents(self, field: Field) -> list[str]:
+        rank = self._metadata.rank
+        return [
+            str(int(s)) if isinstance(s, sp.Integer) else f"__bench_n{c}"
+            for c, s in enumerate(field.shape[:rank])
+        ] + [str(int(s)) for s in field.index_shape]
+
+    def _iteration_extents(self) -> list[str]:
+        """Number of cells updated by the kernel in each spatial coordinate.
+
+        Determined from the ghost layers or iteration slice of the kernel's configuration;
+        if neither is set, the ghost layers are inferred from the kernel's field accesses,
+        as pystencils does."""
+        rank = self._metadata.rank
+        extents = [f"__bench_n{c}" for c in range(rank)]
+
+        config = self._khandle.config
+        ghost_layers = config.get_option("ghost_layers") if config is not None else None
+        islice = config.get_option("iteration_slice") if config is not None else None
+
+        if islice is not None:
+            if not isinstance(islice, tuple):
+                islice = (islice,)
+            if len(islice) != rank:
+                raise ValueError(
+                    f"Cannot benchmark kernel {self._khandle.name}: "
+                    "Its iteration slice does not cover every spatial coordinate."
+                )
+
+            result: list[str] = []
+            for n, sl in zip(extents, islice):
+                if not isinstance(sl, slice):
+                    result.append("1")
+                    continue
+
+                def bound(b, default: str) -> str:
+                    if b is None:
+                        return default
+                    if not isinstance(b, (int, sp.Integer)):
+                        raise ValueError(
+                            f"Cannot benchmark kernel {self._khandle.name}: "
+                            f"Its iteration slice has a non-constant bound {b}."
+                        )
+                    return f"{n} - {-int(b)}" if b < 0 else str(int(b))
+
+                start = bound(sl.start, "0")
+                stop = bound(sl.stop, n)
+                step = int(sl.step) if sl.step is not None else 1
+                result.append(
+                    f"std::max< int64_t >( ( {stop} - ( {start} ) + {step - 1} ) / {step}, 0 )"
+                )
+            return result
+
+        if ghost_layers is None:
+            assert self._khandle.assignments is not None
+            accesses = set().union(
+                *(
+                    {asm.lhs} | asm.rhs.atoms(Field.Access)
+                    for asm in self._khandle.assignments.all_assignments
+                )
+            )
+            ghost_layers = max(
+                (
+                    abs(int(o))
+                    for acc in accesses
+                    if isinstance(acc, Field.Access) and not acc.is_absolute_access
+                    for o in acc.offsets
+                ),
+                default=0,
+            )
+
+        if isinstance(ghost_layers, int):
+            ghost_layers = [ghost_layers] * rank
+
+        result = []
+        for n, gl in zip(extents, ghost_layers):
+            lo, hi = gl if isinstance(gl, tuple) else (gl, gl)
+            result.append(f"std::max< int64_t >( {n} - {lo + hi}, 0 )")
+        return result
+
+    def _field_strides(self, field: Field) -> list[str]:
+        extents = self._field_extents(field)
+        strides = [""] * len(extents)
+        faster: list[str] = []
+        for coord in reversed(field.layout):
+            strides[coord] = " * ".join(faster) if faster else "1"
+            faster.append(extents[coord])
+        return strides
+
+    def _define_params(self) -> SfgStatements:
+        lines: list[str] = []
+        params: list[SfgKernelParamVar] = []
+        buffers: set[str] = set()
+
+        for param in self._khandle.parameters:
+            dtype = param.dtype
+            prop_code: str | None = None
+            for prop in param.wrapped.properties:
+                match prop:
+                    case FieldBasePtr(field):  # type: ignore
+                        assert isinstance(dtype, PsPointerType)
+                        elem_type = deconstify(dtype.base_type).c_string()
+                        size = " * ".join(self._field_extents(field))
+                        buf = f"__bench_buf_{field.name}"
+                        if buf not in buffers:
+                            buffers.add(buf)
+                            lines.append(
+                                f"std::vector< {elem_type} > {buf} ( {size}, {elem_type}(1) );"
+                            )
+                        prop_code = f"{buf}.data()"
+                    case FieldShape(field, coord):  # type: ignore
+                        prop_code = self._field_extents(field)[coord]
+                    case FieldStride(field, coord):  # type: ignore
+                        prop_code = self._field_strides(field)[coord]
+
+            if prop_code is None:
+                lines.append(
+                    f"{dtype.c_string()} {param.name} {{ {deconstify(dtype).c_string()}(1) }};"
+                )
+            elif isinstance(dtype, PsPointerType):
+                lines.append(
+                    f"{dtype.base_type.c_string()} * {param.name} {{ {prop_code} }};"
+                )
+            else:
+                lines.append(
+                    f"{dtype.c_string()} {param.name} {{ {deconstify(dtype).c_string()}( {prop_code} ) }};"
+                )
+            params.append(param)
+
+        return SfgStatements("\n".join(lines), params, (), [HeaderFile.parse("<vector>")])
+
+    def resolve(self) -> SfgCallTreeNode:
+        md = self._metadata
+        exprs: list[ExprLike] = self._shape + [self._repetitions, self._warmup]
+        if self._out is not None:
+            exprs.append(self._out)
+            out = str(self._out)
+            out_includes = [HeaderFile.parse("<ostream>")]
+        else:
+            out = "std::cout"
+            out_includes = [HeaderFile.parse("<iostream>")]
+
+        extents = [f"__bench_n{c}" for c in range(md.rank)]
+        setup = SfgStatements(
+            "\n".join(
+                f"const int64_t {n} {{ int64_t( {s} ) }};"
+                for n, s in zip(extents, self._shape)
+            ),
+            (),
+            set().union(*(depends(e) for e in exprs)),
+            [HeaderFile.parse("<cstdint>")]
+            + list(set().union(*(includes(e) for e in exprs))),
+        )
+
+        clock = "std::chrono::steady_clock"
+        #   Only cells inside the kernel's iteration space are updated
+        iteration_extents = self._iteration_extents()
+        cells = (
+            " * ".join(f"int64_t( {e} )" for e in iteration_extents)
+            if iteration_extents
+            else "int64_t( 1 )"
+        )
+        shape_json = ' << ", " << '.join(extents) if extents else '""'
+
+        report = SfgStatements(
+            "const double __bench_seconds { std::max( std::chrono::duration< double >"
+            f"( {clock}::now() - __bench_start ).count(), 1.0e-12 ) }};\n"
+            f"const int64_t __bench_cells {{ {cells} }};\n"
+            "const double __bench_updates { double( __bench_cells ) * "
+            f"double( {self._repetitions} ) }};\n"
+            f'{out} << "{{ \\"kernel\\": \\"{self._khandle.fqname}\\", \\"shape\\": [ " << {shape_json}\n'
+            '    << " ], \\"cells\\": " << __bench_cells\n'
+            f'    << ", \\"repetitions\\": " << int64_t( {self._repetitions} )\n'
+            '    << ", \\"seconds\\": " << __bench_seconds\n'
+            '    << ", \\"mlups\\": " << __bench_updates / __bench_seconds * 1.0e-6\n'
+            '    << ", \\"gbytes_per_second\\": " << __bench_updates * '
+            f"{md.bytes_loaded + md.bytes_stored}.0 / __bench_seconds * 1.0e-9\n"
+            '    << ", \\"gflops_per_second\\": " << __bench_updates * '
+            f"{md.flops}.0 / __bench_seconds * 1.0e-9\n"
+            '    << " }" << std::endl;',
+            (),
+            (),
+            [HeaderFile.parse("<algorithm>")] + out_includes,
+        )
+
+        def repeat(count: ExprLike, counter: str) -> str:
+            return f"for(int64_t {counter} = 0; {counter} < int64_t( {count} ); ++{counter})"
+
+        return SfgBlock(
+            make_sequence(
+                setup,
+                self._define_params(),
+                repeat(self._warmup, "__bench_w"),
+                (SfgKernelCallNode(self._khandle),),
+                SfgStatements(
+                    f"const auto __bench_start = {clock}::now();",
+                    (),
+                    (),
+                    [HeaderFile.parse("<chrono>")],
+                ),
+                repeat(self._repetitions, "__bench_r"),
+                (SfgKernelCallNode(self._khandle),),
+                report,
+            )
+        )
@@ -1,20 +1,35 @@
 from __future__ import annotations
-from typing import Sequence
+from typing import Sequence, Mapping
 from itertools import takewhile, dropwhile
 import numpy as np
 
-from pystencils.types import create_type
+from pystencils import Field, FieldType
+from pystencils.codegen import GpuKernel
+from pystencils.codegen.properties import FieldBasePtr
+from pystencils.types import (
+    create_type,
+    deconstify,
+    PsType,
+    PsPointerType,
+    PsStructType,
+    UserTypeSpec,
+)
 
 from ..context import SfgContext, SfgCursor
 from ..lang import (
     VarLike,
     ExprLike,
+    AugExpr,
+    HeaderFile,
     asvar,
     SfgVar,
 )
 
 from ..ir import (
     SfgCallTreeNode,
+    SfgKernelHandle,
+    SfgStatements,
+    SfgBranch,
     SfgClass,
     SfgConstructor,
     SfgMethod,
@@ -26,14 +41,17 @@ from ..ir import (
     SfgEntityDef,
     SfgClassBody,
 )
+from ..ir.entities import CommonFunctionProperties
 from ..exceptions import SfgException
 
 from .mixin import SfgComposerMixIn
 from .basic_composer import (
     make_sequence,
+    make_statements,
     SequencerArg,
     SfgFunctionSequencerBase,
 )
+from .gpu_composer import GpuInvocationBuilder
 
 
 class SfgMethodSequencer(SfgFunctionSequencerBase):
@@ -44,6 +62,7 @@ class SfgMethodSequencer(SfgFunctionSequencerBase):
         self._static: bool = False
         self._virtual: bool = False
         self._override: bool = False
+        self._bound_vars: tuple[SfgVar, ...] = ()
 
         self._tree: SfgCallTreeNode
 
@@ -71,6 +90,11 @@ class SfgMethodSequencer(SfgFunctionSequencerBase):
         self._tree = make_sequence(*args)
         return self
 
+    def _bind(self, *vars: SfgVar):
+        """Mark variables as held by members of the class, such that they do not become parameters."""
+        self._bound_vars += vars
+        return self
+
     def _resolve(self, ctx: SfgContext, cls: SfgClass, vis_block: SfgVisibilityBlock):
         method = SfgMethod(
             self._name,
@@ -85,6 +109,7 @@ class SfgMethodSequencer(SfgFunctionSequencerBase):
             override=self._override,
             attributes=self._attributes,
             required_params=self._params,
+            bound_vars=self._bound_vars,
         )
         cls.add_member(method, vis_block.visibility)
 
@@ -222,6 +247,85 @@ class SfgClassComposer(SfgComposerMixIn):
         """
         return self._struct_from_numpy_dtype(name, dtype, add_constructor)
 
+    def index_field(
+        self,
+        field_name: str,
+        struct_name: str,
+        spatial_dimensions: int,
+        members: np.dtype | Mapping[str, UserTypeSpec] | None = None,
+        coordinate_type: UserTypeSpec = "int32",
+        add_constructor: bool = True,
+    ) -> Field:
+        """Create an index list field for sparse kernels, and add its element type as a C++ struct.
+
+        Pystencils' index list kernels iterate only over the cells listed in a one-dimensional
+        index field, instead of the entire domain.
+        Each entry of the index field is a struct holding the spatial coordinates
+        ``x``, ``y`` (and ``z``) of a cell, followed by an arbitrary number of additional members.
+        This method creates that struct type, emits its definition to the header file,
+        and returns an index field of that type.
+        Pass the field as ``index_field`` to the kernel's `CreateKernelConfig`,
+        and map it onto an ``std::vector`` or ``std::span`` of the struct type
+        using `map_field <SfgBasicComposer.map_field>`:
+
+        >>> from pystencilssfg.lang.cpp import std
+        >>> idx = sfg.index_field("idx", "BoundaryLink", 2, {"dir": "int32"})
+        >>> idx.dtype.c_string()
+        'BoundaryLink'
+        >>> idx_vec = std.vector.from_field(idx, const=True)
+
+        Since the kernels reference the struct type, it must be created before them.
+
+        Args:
+            field_name: Name of the index field
+            struct_name: Name of the generated struct
+            spatial_dimensions: Number of spatial coordinates stored in each index entry
+            members: Additional members of the struct, as a numpy structured data type
+                or a mapping from member names to types
+            coordinate_type: Data type of the spatial coordinates
+            add_constructor: If `True`, add a constructor initializing all members to the struct
+
+        Returns:
+            The index field, of type `FieldType.INDEXED`
+        """
+        if spatial_dimensions not in (1, 2, 3):
+            raise ValueError(
+                f"Invalid number of spatial dimensions for index field: {spatial_dimensions}"
+            )
+
+        coord_type = create_type(coordinate_type)
+        struct_members: list[tuple[str, PsType]] = [
+            (coord, coord_type) for coord in ("x", "y", "z")[:spatial_dimensions]
+        ]
+
+        extra_members: list[tuple[str, PsType]]
+        if members is None:
+            extra_members = []
+        elif isinstance(members, np.dtype):
+            if members.fields is None:
+                raise ValueError(f"Numpy dtype {members} is not a structured type.")
+            extra_members = [
+                (name, create_type(type_info[0]))
+                for name, type_info in members.fields.items()
+            ]
+        else:
+            extra_members = [(name, create_type(t)) for name, t in members.items()]
+
+        for name, _ in extra_members:
+            if name in ("x", "y", "z"):
+                raise ValueError(
+                    f"Member name {name} of index struct {struct_name} is reserved for spatial coordinates"
+                )
+
+        struct_members += extra_members
+
+        self._struct_from_members(struct_name, struct_members, add_constructor)
+
+        struct_type = PsStructType(struct_members, name=struct_name)
+        return Field.create_generic(
+            field_name, 1, dtype=struct_type, field_type=FieldType.INDEXED
+        )
+
     @property
     def public(self) -> SfgClassComposer.VisibilityBlockSequencer:
         """Create a `public` visibility block in a class body"""
@@ -258,6 +362,150 @@ class SfgClassComposer(SfgComposerMixIn):
             seq.inline()
         return seq
 
+    def bound_kernel(
+        self,
+        class_name: str,
+        kernel_handle: SfgKernelHandle,
+        *,
+        shared_memory_bytes: ExprLike = "0",
+        stream: ExprLike | None = None,
+        **launch_args,
+    ):
+        """Create a class binding a kernel to a fixed set of fields.
+
+        Usage:
+
+        .. code-block:: Python
+
+            sfg.bound_kernel("BoundScale", khandle, block_size=block_size)(
+                sfg.map_field(f, ...),
+                sfg.map_field(g, ...),
+            )
+
+        The generated class stores the data pointers, shapes, and strides of all
+        fields accessed by the kernel, as extracted by the given field mappings,
+        in member variables.
+        For GPU kernels, it additionally stores the launch grid, computed from the
+        launch configuration arguments in ``launch_args``
+        (as accepted by `gpu_invoke <SfgGpuComposer.gpu_invoke>`).
+        The class provides the following members:
+
+        - A constructor and a ``rebind`` method, both taking the mapped objects as arguments.
+          They run the field mappings, check that no data pointer is null
+          (throwing ``std::invalid_argument`` otherwise),
+          and store the results.
+          Call ``rebind`` whenever the underlying buffers change.
+        - A ``const`` function call operator, taking only the kernel's scalar parameters
+          and, if ``stream`` is a free variable, the stream.
+          It calls or launches the kernel using the stored parameters, without
+          any further extraction or launch grid computation.
+
+        Args:
+            class_name: Name of the generated class
+            kernel_handle: The kernel to bind
+            shared_memory_bytes: Dynamic shared memory size of GPU kernel launches
+            stream: Stream to launch GPU kernels on
+            launch_args: Launch configuration arguments for GPU kernels
+        """
+        is_gpu = isinstance(kernel_handle.kernel, GpuKernel)
+
+        if not is_gpu and launch_args:
+            raise ValueError(
+                f"Launch configuration arguments were given for non-GPU kernel {kernel_handle.name}: "
+                + ", ".join(launch_args.keys())
+            )
+
+        def member_type(dtype: PsType) -> PsType:
+            dtype = deconstify(dtype)
+            if isinstance(dtype, PsPointerType):
+                return PsPointerType(dtype.base_type, restrict=False)
+            return dtype
+
+        field_params = [
+            p for p in kernel_handle.parameters if p.wrapped.is_field_parameter
+        ]
+        members: list[SfgVar] = [
+            SfgVar(p.name, member_type(p.dtype)) for p in field_params
+        ]
+
+        #   Variables of the kernel call held by the members
+        bound_vars: list[SfgVar] = list(field_params)
+
+        null_checks: list[SfgCallTreeNode] = []
+        for param in field_params:
+            for prop in param.wrapped.properties:
+                match prop:
+                    case FieldBasePtr(field):  # type: ignore
+                        null_checks.append(
+                            SfgBranch(
+                                SfgStatements(
+                                    f"{param.name} == nullptr", (), (param,)
+                                ),
+                                make_sequence(
+                                    SfgStatements(
+                                        f'throw std::invalid_argument("{class_name}: '
+                                        f'Null data pointer for field {field.name}");',
+                                        (),
+                                        (),
+                                        (HeaderFile.parse("<stdexcept>"),),
+                                    )
+                                ),
+                            )
+                        )
+
+        stores: list[SfgCallTreeNode] = [
+            SfgStatements(f"this->{p.name} = {p.name};", (), (p,))
+            for p in field_params
+        ]
+
+        launch: SfgCallTreeNode
+        if is_gpu:
+            builder = GpuInvocationBuilder(self._ctx, kernel_handle)
+            builder.shared_memory_bytes = shared_memory_bytes
+            builder.stream = stream
+
+            grid_setup, grid_size, block_size = builder.launch_grid(**launch_args)
+
+            dim3 = builder.gpu_api.dim3
+            grid_member = dim3().var("_grid_size")
+            block_member = dim3().var("_block_size")
+            members += [asvar(grid_member), asvar(block_member)]
+            bound_vars += [asvar(grid_member), asvar(block_member)]
+
+            stores += grid_setup
+            stores += [
+                make_statements(
+                    AugExpr.format("this->{} = {};", grid_member, grid_size)
+                ),
+                make_statements(
+                    AugExpr.format("this->{} = {};", block_member, block_size)
+                ),
+            ]
+
+            launch = builder.invocation(grid_member, block_member)
+        else:
+            launch = self._composer.call(kernel_handle)
+
+        def sequencer(*mappings: SequencerArg):
+            rebind_tree = make_sequence(*mappings, *null_checks, *stores)
+            rebind_params = CommonFunctionProperties.collect_params(
+                rebind_tree, None, bound_vars
+            )
+
+            ctor = self.constructor(*rebind_params).body(
+                "this->rebind(" + ", ".join(p.name for p in rebind_params) + ");"
+            )
+            rebind = (
+                self.method("rebind")
+                .params(*rebind_params)
+                ._bind(*bound_vars)(rebind_tree)
+            )
+            call_op = self.method("operator()").const()._bind(*bound_vars)(launch)
+
+            self.klass(class_name)(*members, self.public(ctor, rebind, call_op))
+
+        return sequencer
+
     #   INTERNALS
 
     def _class(self, class_name: str, keyword: SfgClassKeyword, bases: Sequence[str]):
@@ -319,14 +567,27 @@ class SfgClassComposer(SfgComposerMixIn):
         if fields is None:
             raise SfgException(f"Numpy dtype {dtype} is not a structured type.")
 
+        return self._struct_from_members(
+            struct_name,
+            [
+                (member_name, create_type(type_info[0]))
+                for member_name, type_info in fields.items()
+            ],
+            add_constructor,
+        )
+
+    def _struct_from_members(
+        self,
+        struct_name: str,
+        struct_members: Sequence[tuple[str, PsType]],
+        add_constructor: bool = True,
+    ):
         members: list[SfgClassComposer.ConstructorBuilder | SfgVar] = []
         if add_constructor:
             ctor = self.constructor()
             members.append(ctor)
 
-        for member_name, type_info in fields.items():
-            member_type = create_type(type_info[0])
-
+        for member_name, member_type in struct_members:
             member = SfgVar(member_name, member_type)
             members.append(member)
 
@@ -1,8 +1,19 @@
 from __future__ import annotations
 
-from typing import overload
+from typing import overload, Sequence
 
+import sympy as sp
+
+from pystencils import Field, DynamicType
+from pystencils.types import (
+    UserTypeSpec,
+    deconstify,
+    PsNumericType,
+    PsBoolType,
+    PsPointerType,
+)
 from pystencils.codegen import GpuKernel, Target
+from pystencils.codegen.properties import FieldShape
 from pystencils.codegen.gpu_indexing import (
     ManualLaunchConfiguration,
     AutomaticLaunchConfiguration,
@@ -10,17 +21,39 @@ from pystencils.codegen.gpu_indexing import (
 )
 
 from .mixin import SfgComposerMixIn
-from .basic_composer import make_statements, make_sequence
+from .basic_composer import (
+    make_statements,
+    make_sequence,
+    SequencerArg,
+    SplitKernels,
+    dispatch_variants,
+)
 
 from ..context import SfgContext
 from ..ir import (
     SfgKernelHandle,
     SfgCallTreeNode,
     SfgGpuKernelInvocation,
+    SfgStatements,
     SfgBlock,
     SfgSequence,
+    SfgBranch,
 )
-from ..lang import ExprLike, AugExpr
+from ..ir.postprocessing import SfgDeferredNode
+from ..ir.profiling import SfgUnprofiledSequence
+from ..exceptions import SfgException
+from ..lang import (
+    SfgVar,
+    HeaderFile,
+    ExprLike,
+    AugExpr,
+    SupportsFieldExtraction,
+    asvar,
+    depends,
+    includes,
+)
+from ..lang.types import Ref
+from ..lang.cpp.std_vector import StdVector
 from ..lang.gpu import CudaAPI, HipAPI, ProvidesGpuRuntimeAPI
 
 
@@ -55,7 +88,7 @@ class SfgGpuComposer(SfgComposerMixIn):
         causes the launch grid to be determined automatically,
         such as `Blockwise4D <pystencils.codegen.config.GpuIndexingScheme.Blockwise4D>`.
 
-    .. function:: gpu_invoke(self, kernel_handle: SfgKernelHandle, *, block_size: ExprLike | None = None, shared_memory_bytes: ExprLike = "0", stream: ExprLike | None = None, ) -> SfgCallTreeNode
+    .. function:: gpu_invoke(self, kernel_handle: SfgKernelHandle, *, block_size: ExprLike | None = None, block_size_from_occupancy: bool = False, shared_memory_bytes: ExprLike = "0", stream: ExprLike | None = None, ) -> SfgCallTreeNode
         :noindex:
 
         Invoke a GPU kernel with a dynamic launch grid.
@@ -65,6 +98,17 @@ class SfgGpuComposer(SfgComposerMixIn):
         The grid size is calculated automatically by dividing the number of work items in each
         dimension by the block size, rounding up.
 
+        If ``block_size_from_occupancy`` is set to `True`, no block size may be given.
+        Instead, the generated code queries the occupancy-maximizing number of threads per block
+        for the kernel from the GPU runtime
+        (via ``cudaOccupancyMaxPotentialBlockSize`` or ``hipOccupancyMaxPotentialBlockSize``).
+        If ``shared_memory_bytes`` is an integer literal, the query runs only once per kernel,
+        and its result is cached in a function-local static variable;
+        otherwise, it is repeated on each invocation.
+        Should the query fail, the launch configuration's default block size is used instead.
+        The threads are then distributed across the block's dimensions such that no dimension
+        of the block exceeds the number of work items in that dimension.
+
     .. _Launch Configurations in CUDA: https://docs.nvidia.com/cuda/cuda-c-programming-guide/index.html#execution-configuration
 
     .. _Launch Configurations in HIP: https://rocmdocs.amd.com/projects/HIP/en/latest/how-to/hip_cpp_language_extensions.html#calling-global-functions
@@ -96,6 +140,7 @@ class SfgGpuComposer(SfgComposerMixIn):
         kernel_handle: SfgKernelHandle,
         *,
         block_size: ExprLike | None = None,
+        block_size_from_occupancy: bool = False,
         shared_memory_bytes: ExprLike = "0",
         stream: ExprLike | None = None,
     ) -> SfgCallTreeNode: ...
@@ -113,6 +158,274 @@ class SfgGpuComposer(SfgComposerMixIn):
 
         return builder(**kwargs)
 
+    def gpu_invoke_split(
+        self,
+        split: SplitKernels,
+        *,
+        interior_stream: ExprLike,
+        boundary_stream: ExprLike,
+        interior_event: ExprLike | None = None,
+        boundary_event: ExprLike | None = None,
+        shared_memory_bytes: ExprLike = "0",
+        **kwargs,
+    ) -> SfgCallTreeNode:
+        """Invoke the interior and boundary kernels of a split kernel on separate streams.
+
+        The boundary kernels, created by `create_split <KernelsAdder.create_split>`,
+        are enqueued on ``boundary_stream`` first, followed by the interior kernel on ``interior_stream``.
+        If ``boundary_event`` and ``interior_event`` are given, each is recorded on its stream
+        after the respective kernels were enqueued.
+        The host code may then wait on ``boundary_event`` and start halo communication
+        while the interior is still being computed.
+
+        All remaining keyword arguments are forwarded to `gpu_invoke` for each kernel.
+        For kernels generated with
+        `manual_launch_grid <pystencils.codegen.config.GpuOptions.manual_launch_grid>`
+        and the ``linear3d`` indexing scheme, only ``block_size`` may be passed;
+        the grid size of each region is then computed from its extents.
+
+        Args:
+            split: The split kernel
+            interior_stream: Stream to launch the interior kernel on
+            boundary_stream: Stream to launch the boundary kernels on
+            interior_event: Event to record on ``interior_stream`` after the interior kernel
+            boundary_event: Event to record on ``boundary_stream`` after the boundary kernels
+        """
+        builders: list[GpuInvocationBuilder] = []
+        for khandle in split.boundary + [split.interior]:
+            builder = GpuInvocationBuilder(self._ctx, khandle)
+            builder.shared_memory_bytes = shared_memory_bytes
+            builder.stream = (
+                interior_stream if khandle is split.interior else boundary_stream
+            )
+            if isinstance(builder.launch_config, ManualLaunchConfiguration):
+                builder.work_items = _split_region_work_items(split, khandle)
+            builders.append(builder)
+
+        gpu_api = builders[0].gpu_api
+
+        def record(event: ExprLike | None, stream: ExprLike) -> list[SfgCallTreeNode]:
+            if event is None:
+                return []
+            return [
+                make_statements(
+                    AugExpr.format("{};", gpu_api.event_record(event, stream))
+                )
+            ]
+
+        return make_sequence(
+            *(b(**kwargs) for b in builders[:-1]),
+            *record(boundary_event, boundary_stream),
+            builders[-1](**kwargs),
+            *record(interior_event, interior_stream),
+        )
+
+    def gpu_graph(self, stream: ExprLike):
+        """Capture a sequence of GPU kernel invocations into a CUDA or HIP graph.
+
+        Usage:
+
+        .. code-block:: Python
+
+            sfg.function("timestep")(
+                sfg.map_field(f, ...),
+                sfg.map_field(g, ...),
+                sfg.gpu_graph(stream)(
+                    sfg.gpu_invoke(kernel1, stream=stream),
+                    sfg.gpu_invoke(kernel2, stream=stream),
+                ),
+            )
+
+        On its first execution, the generated code captures all work submitted to ``stream``
+        within the graph's body into a graph, instantiates it, and launches it on ``stream``.
+        The executable graph is kept in a function-local static variable;
+        subsequent executions only launch it again.
+        The values of all variables the body depends on (such as field pointers, shapes, and strides)
+        are recorded alongside the graph.
+        If any of them change, the body is captured anew, and the executable graph's
+        node parameters are updated from the new capture.
+        If that update fails because the graph's topology changed, the graph is re-instantiated.
+        If capturing, instantiating, updating, or launching the graph fails otherwise,
+        an ``std::runtime_error`` is thrown.
+
+        All kernel invocations inside the graph must be submitted to ``stream``.
+        Field mappings (`map_field <SfgBasicComposer.map_field>`) and parameter setters must be placed
+        outside of the graph's body.
+
+        Args:
+            stream: The stream to capture the graph on and to launch it on
+        """
+
+        def sequencer(*args: SequencerArg) -> SfgCallTreeNode:
+            builder = GpuGraphBuilder(make_sequence(*args), stream)
+            return builder.resolve()
+
+        return sequencer
+
+    def gpu_upload(
+        self,
+        field: Field,
+        host: SupportsFieldExtraction,
+        device: SupportsFieldExtraction,
+        *,
+        stream: ExprLike,
+        target: Target = Target.CUDA,
+    ) -> SfgCallTreeNode:
+        """Asynchronously copy the data of a field from host to device memory.
+
+        Emits a ``cudaMemcpyAsync`` or ``hipMemcpyAsync`` on ``stream``.
+        The data pointers of the host and device buffers, as well as the field's extents,
+        are obtained through the `SupportsFieldExtraction` interface of ``host`` and ``device``;
+        both buffers must store the field contiguously and in the same layout.
+        A buffer exposing an extent for each of the field's coordinates (e.g. an ``std::mdspan``)
+        yields the number of elements as the product of its extents; a one-dimensional buffer
+        exposing only its first extent (e.g. an ``std::vector``) is assumed to hold
+        exactly the field's elements.
+        If the element counts of both buffers are known, they are compared at runtime,
+        and an ``std::invalid_argument`` exception is thrown if they differ.
+        If the copy cannot be enqueued, an ``std::runtime_error`` is thrown.
+        To overlap transfers with kernel execution, use the same stream as in `gpu_invoke`,
+        and back the host buffer with page-locked memory (see `gpu_pinned_vector`).
+
+        Args:
+            field: The field whose data is copied
+            host: The host buffer
+            device: The device buffer
+            stream: The stream to enqueue the copy on
+            target: The GPU target, either `Target.CUDA` or `Target.HIP`
+        """
+        return self._gpu_memcpy(field, device, host, "HostToDevice", stream, target)
+
+    def gpu_download(
+        self,
+        field: Field,
+        device: SupportsFieldExtraction,
+        host: SupportsFieldExtraction,
+        *,
+        stream: ExprLike,
+        target: Target = Target.CUDA,
+    ) -> SfgCallTreeNode:
+        """Asynchronously copy the data of a field from device to host memory.
+
+        Counterpart of `gpu_upload`; see there for details.
+        """
+        return self._gpu_memcpy(field, host, device, "DeviceToHost", stream, target)
+
+    def gpu_prefetch(
+        self,
+        field: Field,
+        managed: SupportsFieldExtraction,
+        *,
+        stream: ExprLike,
+        device: ExprLike = "0",
+        target: Target = Target.CUDA,
+    ) -> SfgCallTreeNode:
+        """Asynchronously migrate the managed memory holding a field to a GPU.
+
+        Emits a ``cudaMemPrefetchAsync`` or ``hipMemPrefetchAsync`` on ``stream``,
+        such that the field's data is resident on ``device`` before subsequent kernels on ``stream`` access it.
+        The number of elements is determined as in `gpu_upload`.
+        If the prefetch cannot be enqueued, an ``std::runtime_error`` is thrown.
+
+        Args:
+            field: The field whose data is migrated
+            managed: The buffer in managed memory holding the field
+            stream: The stream to enqueue the prefetch on
+            device: ID of the device to migrate the data to
+            target: The GPU target, either `Target.CUDA` or `Target.HIP`
+        """
+        api = _gpu_api(target)
+        count = _field_bytes(field, managed)
+        return _checked_call(
+            api,
+            api.mem_prefetch_async(managed._extract_ptr(), count, device, stream),
+            f"Prefetching field {field.name} failed",
+        )
+
+    def gpu_pinned_vector(
+        self,
+        T: UserTypeSpec,
+        *,
+        ref: bool = False,
+        const: bool = False,
+        target: Target = Target.CUDA,
+    ) -> StdVector:
+        """Create an ``std::vector`` type whose elements reside in page-locked host memory.
+
+        The vector uses an allocator backed by ``cudaMallocHost`` or ``hipHostMalloc``,
+        whose definition is emitted into the generated header file.
+        Asynchronous copies (see `gpu_upload` and `gpu_download`) from and to such vectors
+        do not block the host and may overlap with kernel execution.
+
+        Args:
+            T: Element type of the vector
+            ref: If `True`, model a reference to the vector
+            const: If `True`, model a ``const`` vector
+            target: The GPU target, either `Target.CUDA` or `Target.HIP`
+        """
+        api = _gpu_api(target)
+
+        header = self._ctx.header_file
+        definition = api.pinned_allocator_definition()
+        if definition not in header.elements:
+            #   Place the allocator in the global namespace, ahead of all generated code
+            header.elements.insert(0, definition)
+            header.includes += [
+                HeaderFile.parse(h) for h in (api.runtime_header, "<cstddef>", "<new>")
+            ]
+
+        return StdVector(
+            T, ref=ref, const=const, allocator=api.pinned_allocator(T)
+        )
+
+    def _gpu_memcpy(
+        self,
+        field: Field,
+        dst: SupportsFieldExtraction,
+        src: SupportsFieldExtraction,
+        kind: str,
+        stream: ExprLike,
+        target: Target,
+    ) -> SfgCallTreeNode:
+        api = _gpu_api(target)
+        count = _field_bytes(field, dst, src)
+
+        nodes: list[SfgCallTreeNode] = []
+
+        dst_numel = _field_numel(field, dst)
+        src_numel = _field_numel(field, src)
+        if (
+            dst_numel is not None
+            and src_numel is not None
+            and str(dst_numel) != str(src_numel)
+        ):
+            nodes.append(
+                SfgBranch(
+                    make_statements(AugExpr.format("{} != {}", dst_numel, src_numel)),
+                    make_sequence(
+                        SfgStatements(
+                            "throw std::invalid_argument("
+                            f'"Cannot copy field {field.name}: Buffer sizes do not match");',
+                            (),
+                            (),
+                            (HeaderFile.parse("<stdexcept>"),),
+                        )
+                    ),
+                )
+            )
+
+        nodes.append(
+            _checked_call(
+                api,
+                api.memcpy_async(
+                    dst._extract_ptr(), src._extract_ptr(), count, kind, stream
+                ),
+                f"Copying field {field.name} failed",
+            )
+        )
+
+        return make_sequence(*nodes)
+
     def cuda_invoke(
         self,
         kernel_handle: SfgKernelHandle,
@@ -136,6 +449,81 @@ class SfgGpuComposer(SfgComposerMixIn):
         )
 
 
+def _gpu_api(target: Target) -> type[ProvidesGpuRuntimeAPI]:
+    match target:
+        case Target.CUDA:
+            return CudaAPI
+        case Target.HIP:
+            return HipAPI
+        case _:
+            raise ValueError(f"Not a GPU target: {target}")
+
+
+def _checked_call(
+    api: type[ProvidesGpuRuntimeAPI], call: AugExpr, message: str
+) -> SfgCallTreeNode:
+    """Invoke a runtime API function, throwing an ``std::runtime_error`` if it fails."""
+    return SfgBranch(
+        make_statements(AugExpr.format("{} != {}", call, api.success)),
+        make_sequence(
+            SfgStatements(
+                f'throw std::runtime_error("{message}");',
+                (),
+                (),
+                (HeaderFile.parse("<stdexcept>"),),
+            )
+        ),
+    )
+
+
+def _field_numel(field: Field, buffer: SupportsFieldExtraction) -> AugExpr | None:
+    """Number of elements of a field stored in the given buffer, if it can be determined.
+
+    If the buffer exposes an extent for each of the field's coordinates, the number of elements
+    is the product of these extents; fixed entries of the field's shape are used directly.
+    If the buffer is one-dimensional, i.e. exposes only its first extent,
+    that extent is taken as the total number of elements."""
+    if isinstance(field.dtype, DynamicType):
+        raise ValueError(f"Cannot determine the size of dynamically typed field {field}")
+
+    #   As in field extraction, ignore the trivial index dimension of explicit scalar fields
+    if field.index_shape == (1,):
+        rank = field.spatial_dimensions
+    else:
+        rank = len(field.shape)
+
+    shape = field.shape[:rank]
+    if all(isinstance(s, (int, sp.Integer)) for s in shape):
+        return AugExpr.format(" * ".join(str(s) for s in shape))
+
+    buffer_extents = [buffer._extract_size(coord) for coord in range(rank)]
+
+    if all(e is not None for e in buffer_extents):
+        extents: list[ExprLike] = [
+            str(s) if isinstance(s, (int, sp.Integer)) else AugExpr.format("std::size_t( {} )", e)
+            for s, e in zip(shape, buffer_extents)
+        ]
+        return AugExpr.format(" * ".join(["{}"] * len(extents)), *extents)
+    elif buffer_extents[0] is not None and buffer._extract_size(1) is None:
+        return AugExpr.format("std::size_t( {} )", buffer_extents[0])
+    else:
+        return None
+
+
+def _field_bytes(field: Field, *buffers: SupportsFieldExtraction) -> AugExpr:
+    """Size of a contiguously stored field in bytes.
+
+    The number of elements is taken from the first of ``buffers`` it can be determined from;
+    see `_field_numel`."""
+    for buf in buffers:
+        if (numel := _field_numel(field, buf)) is not None:
+            return AugExpr.format(
+                "sizeof( {} ) * {}", deconstify(field.dtype).c_string(), numel
+            )
+
+    raise SfgException(f"Cannot determine the number of elements of field {field}")
+
+
 class GpuInvocationBuilder:
     def __init__(
         self,
@@ -168,6 +556,27 @@ class GpuInvocationBuilder:
 
         self._shared_memory_bytes: ExprLike = "0"
         self._stream: ExprLike | None = None
+        self._work_items: Sequence[ExprLike] | None = None
+
+    @property
+    def launch_config(self):
+        return self._launch_config
+
+    @property
+    def gpu_api(self) -> type[ProvidesGpuRuntimeAPI]:
+        return self._gpu_api
+
+    @property
+    def work_items(self) -> Sequence[ExprLike] | None:
+        """Number of work items in each dimension of the launch grid.
+
+        Used to compute the grid size of kernels with a manual launch configuration
+        if no grid size is given at invocation."""
+        return self._work_items
+
+    @work_items.setter
+    def work_items(self, wi: Sequence[ExprLike] | None):
+        self._work_items = wi
 
     @property
     def shared_memory_bytes(self) -> ExprLike:
@@ -195,37 +604,98 @@ class GpuInvocationBuilder:
             make_statements(self._stream) if self._stream is not None else None
         )
 
-        return make_sequence(
-            "/* clang-format off */",
-            "/* [pystencils-sfg] Formatting may add illegal spaces between angular brackets in `<<< >>>` */",
-            SfgGpuKernelInvocation(
-                self._kernel_handle,
+        def invoke(
+            khandle: SfgKernelHandle, args_from: SfgKernelHandle | None
+        ) -> SfgCallTreeNode:
+            return SfgGpuKernelInvocation(
+                khandle,
                 stmt_grid_size,
                 stmt_block_size,
                 shared_memory_bytes=stmt_smem,
                 stream=stmt_stream,
-            ),
+                args_from=args_from,
+            )
+
+        #   All variants share the iteration space, and hence the launch grid, of the kernel
+        invocation = dispatch_variants(self._kernel_handle, invoke)
+
+        return make_sequence(
+            "/* clang-format off */",
+            "/* [pystencils-sfg] Formatting may add illegal spaces between angular brackets in `<<< >>>` */",
+            invocation,
             "/* clang-format on */",
         )
 
-    def __call__(self, **kwargs: ExprLike) -> SfgCallTreeNode:
+    def __call__(self, **kwargs) -> SfgCallTreeNode:
+        setup, grid_size, block_size = self.launch_grid(**kwargs)
+        invocation = self._render_invocation(grid_size, block_size)
+        if not setup:
+            return invocation
+        return SfgBlock(SfgSequence(setup + [invocation]))
+
+    def invocation(self, grid_size: ExprLike, block_size: ExprLike) -> SfgSequence:
+        """Invoke the kernel on a precomputed launch grid,
+        e.g. as returned by `launch_grid`."""
+        return self._render_invocation(grid_size, block_size)
+
+    def launch_grid(self, **kwargs) -> tuple[list[SfgCallTreeNode], ExprLike, ExprLike]:
+        """Compute the kernel's launch grid.
+
+        Accepts the same keyword arguments as `gpu_invoke <SfgGpuComposer.gpu_invoke>`
+        for the kernel's launch configuration.
+
+        Returns:
+            The nodes setting up the launch grid, and the grid size and block size expressions
+            defined by them.
+        """
         match self._launch_config:
             case ManualLaunchConfiguration():
-                return self._invoke_manual(**kwargs)
+                return self._grid_manual(**kwargs)
             case AutomaticLaunchConfiguration():
-                return self._invoke_automatic(**kwargs)
+                return self._grid_automatic(**kwargs)
             case DynamicBlockSizeLaunchConfiguration():
-                return self._invoke_dynamic(**kwargs)
+                return self._grid_dynamic(**kwargs)
             case _:
                 raise ValueError(
                     f"Unexpected launch configuration: {self._launch_config}"
                 )
 
-    def _invoke_manual(self, grid_size: ExprLike, block_size: ExprLike):
+    def _grid_manual(
+        self, block_size: ExprLike, grid_size: ExprLike | None = None
+    ) -> tuple[list[SfgCallTreeNode], ExprLike, ExprLike]:
         assert isinstance(self._launch_config, ManualLaunchConfiguration)
-        return self._render_invocation(grid_size, block_size)
 
-    def _invoke_automatic(self):
+        if grid_size is not None:
+            return [], grid_size, block_size
+
+        if self._work_items is None:
+            raise ValueError(
+                "A grid size must be specified for kernels with a manual launch configuration."
+            )
+
+        from .composer import SfgComposer
+
+        sfg = SfgComposer(self._ctx)
+
+        block_size_var = self._dim3(const=True).var("__block_size")
+        grid_size_var = self._dim3(const=True).var("__grid_size")
+
+        work_items = list(self._work_items) + ["1"] * (3 - len(self._work_items))
+        grid_size_entries = [
+            self._div_ceil(self._to_uint32_t(AugExpr.format("{}", wi)), bs)
+            for wi, bs in zip(work_items, block_size_var.dims)
+        ]
+
+        return (
+            [
+                sfg.init(block_size_var)(block_size),
+                sfg.init(grid_size_var)(*grid_size_entries),
+            ],
+            grid_size_var,
+            block_size_var,
+        )
+
+    def _grid_automatic(self) -> tuple[list[SfgCallTreeNode], ExprLike, ExprLike]:
         assert isinstance(self._launch_config, AutomaticLaunchConfiguration)
 
         from .composer import SfgComposer
@@ -244,30 +714,28 @@ class GpuInvocationBuilder:
         ]
         block_size_var = self._dim3(const=True).var("__block_size")
 
-        nodes = [
+        nodes: list[SfgCallTreeNode] = [
             sfg.init(grid_size_var)(*grid_size_entries),
             sfg.init(block_size_var)(*block_size_entries),
-            self._render_invocation(grid_size_var, block_size_var),
         ]
 
-        return SfgBlock(SfgSequence(nodes))
+        return nodes, grid_size_var, block_size_var
 
-    def _invoke_dynamic(self, block_size: ExprLike | None = None):
+    def _grid_dynamic(
+        self,
+        block_size: ExprLike | None = None,
+        block_size_from_occupancy: bool = False,
+    ) -> tuple[list[SfgCallTreeNode], ExprLike, ExprLike]:
         assert isinstance(self._launch_config, DynamicBlockSizeLaunchConfiguration)
 
         from .composer import SfgComposer
 
         sfg = SfgComposer(self._ctx)
 
-        block_size_init_args: tuple[ExprLike, ...]
-        if block_size is None:
-            block_size_init_args = tuple(
-                str(bs) for bs in self._launch_config.default_block_size
+        if block_size is not None and block_size_from_occupancy:
+            raise ValueError(
+                "`block_size` and `block_size_from_occupancy` are mutually exclusive."
             )
-        else:
-            block_size_init_args = (block_size,)
-
-        block_size_var = self._dim3(const=True).var("__block_size")
 
         from ..lang.cpp import std
 
@@ -278,11 +746,25 @@ class GpuInvocationBuilder:
             "__work_items"
         )
 
-        def _div_ceil(a: ExprLike, b: ExprLike):
-            return AugExpr.format("({a} + {b} - 1) / {b}", a=a, b=b)
+        block_size_var = self._dim3(const=True).var("__block_size")
+
+        nodes: list[SfgCallTreeNode] = [sfg.init(work_items_var)(*work_items_entries)]
+
+        if block_size_from_occupancy:
+            nodes += self._occupancy_block_size(block_size_var, work_items_var)
+        else:
+            block_size_init_args: tuple[ExprLike, ...]
+            if block_size is None:
+                block_size_init_args = tuple(
+                    str(bs) for bs in self._launch_config.default_block_size
+                )
+            else:
+                block_size_init_args = (block_size,)
+
+            nodes.append(sfg.init(block_size_var)(*block_size_init_args))
 
         grid_size_entries = [
-            _div_ceil(work_items_var.get(i), bs)
+            self._div_ceil(work_items_var.get(i), bs)
             for i, bs in enumerate(
                 [
                     block_size_var.x,
@@ -293,15 +775,311 @@ class GpuInvocationBuilder:
         ]
         grid_size_var = self._dim3(const=True).var("__grid_size")
 
-        nodes = [
-            sfg.init(block_size_var)(*block_size_init_args),
-            sfg.init(work_items_var)(*work_items_entries),
-            sfg.init(grid_size_var)(*grid_size_entries),
-            self._render_invocation(grid_size_var, block_size_var),
-        ]
+        nodes.append(sfg.init(grid_size_var)(*grid_size_entries))
+
+        return nodes, grid_size_var, block_size_var
+
+    #   Upper limit for the z-extent of thread blocks in CUDA
+    _MAX_BLOCK_SIZE_Z = 64
 
-        return SfgBlock(SfgSequence(nodes))
+    def _occupancy_block_size(
+        self, block_size_var: AugExpr, work_items_var: AugExpr
+    ) -> list[SfgCallTreeNode]:
+        """Query the occupancy-maximizing block size from the GPU runtime,
+        and distribute it across the block's dimensions such that no dimension
+        exceeds the number of work items.
+
+        The query result is cached across invocations only if the kernel's
+        dynamic shared memory size is a compile-time constant,
+        since the optimal block size depends on it.
+        If the query fails, the total size of the default block size is used."""
+
+        assert isinstance(self._launch_config, DynamicBlockSizeLaunchConfiguration)
+
+        from .composer import SfgComposer
+
+        sfg = SfgComposer(self._ctx)
+
+        max_threads_var = AugExpr("uint32_t").var("__occupancy_block_size")
+        occupancy_query = self._gpu_api.occupancy_max_potential_block_size(
+            "&__min_grid_size",
+            "&__max_block_size",
+            self._kernel_handle.fqname,
+            self._shared_memory_bytes,
+        )
+
+        fallback_size = " * ".join(
+            str(bs) for bs in self._launch_config.default_block_size
+        )
+        storage = "static const" if str(self._shared_memory_bytes).isdigit() else "const"
+
+        query_stmt = SfgStatements(
+            f"{storage} uint32_t {max_threads_var} = [&]() {{\n"
+            + self._ctx.codestyle.indent(
+                "int __min_grid_size { 0 };\n"
+                "int __max_block_size { 0 };\n"
+                f"if ({occupancy_query} != {self._gpu_api.success} || __max_block_size <= 0) {{\n"
+                f"  return uint32_t({fallback_size});\n"
+                "}\n"
+                "return uint32_t(__max_block_size);"
+            )
+            + "\n}();",
+            (asvar(max_threads_var),),
+            depends(occupancy_query),
+            includes(occupancy_query),
+        )
+
+        def _min(a: ExprLike, b: ExprLike) -> AugExpr:
+            return AugExpr("uint32_t").bind(
+                "std::min<uint32_t>({}, {})", a, b, require_headers=["<algorithm>"]
+            )
+
+        def _at_least_one(a: ExprLike) -> AugExpr:
+            return AugExpr("uint32_t").bind(
+                "std::max<uint32_t>({}, 1)", a, require_headers=["<algorithm>"]
+            )
+
+        bx, by, bz = sfg.vars("__block_size_x, __block_size_y, __block_size_z", "uint32_t")
+
+        return [
+            query_stmt,
+            sfg.init(bx)(
+                _min(max_threads_var, _at_least_one(work_items_var.get(0)))
+            ),
+            sfg.init(by)(
+                _min(
+                    AugExpr.format("{} / {}", max_threads_var, bx),
+                    _at_least_one(work_items_var.get(1)),
+                )
+            ),
+            sfg.init(bz)(
+                _min(
+                    AugExpr.format("{} / ({} * {})", max_threads_var, bx, by),
+                    _min(
+                        _at_least_one(work_items_var.get(2)),
+                        str(self._MAX_BLOCK_SIZE_Z),
+                    ),
+                )
+            ),
+            sfg.init(block_size_var)(bx, by, bz),
+        ]
 
     @staticmethod
     def _to_uint32_t(expr: AugExpr) -> AugExpr:
         return AugExpr("uint32_t").format("uint32_t({})", expr)
+
+    @staticmethod
+    def _div_ceil(a: ExprLike, b: ExprLike) -> AugExpr:
+        return AugExpr.format("({a} + {b} - 1) / {b}", a=a, b=b)
+
+
+def _split_region_work_items(
+    split: SplitKernels, khandle: SfgKernelHandle
+) -> list[ExprLike]:
+    """Number of work items along each dimension of a split kernel's iteration region,
+    ordered from the fastest to the slowest coordinate, as enumerated by the
+    ``linear3d`` indexing scheme."""
+    field = split.domain_field
+    shape_params: dict[int, SfgVar] = dict()
+    for param in khandle.parameters:
+        for prop in param.wrapped.properties:
+            match prop:
+                case FieldShape(f, coord) if f == field:  # type: ignore
+                    shape_params[coord] = param
+
+    def extent(coord: int) -> ExprLike:
+        relative, offset = split.extents[khandle.name][coord]
+        if not relative:
+            return str(offset)
+        shape_entry = field.shape[coord]
+        if isinstance(shape_entry, sp.Integer):
+            return str(int(shape_entry) + offset)
+        elif offset == 0:
+            return shape_params[coord]
+        else:
+            return AugExpr.format("({} - {})", shape_params[coord], -offset)
+
+    spatial_order = [c for c in field.layout if c < field.spatial_dimensions]
+    return [extent(c) for c in reversed(spatial_order)]
+
+
+class GpuGraphBuilder:
+    def __init__(self, body: SfgSequence, stream: ExprLike):
+        self._body = body
+        self._stream = stream
+
+        targets = set(
+            inv.kernel_handle.kernel.target for inv in self._find_invocations(body)
+        )
+
+        match list(targets):
+            case [Target.CUDA]:
+                self._gpu_api: type[ProvidesGpuRuntimeAPI] = CudaAPI
+            case [Target.HIP]:
+                self._gpu_api = HipAPI
+            case []:
+                raise ValueError(
+                    "The body of `gpu_graph` contains no GPU kernel invocations."
+                )
+            case _:
+                raise ValueError(
+                    "Cannot mix kernels of different GPU targets inside `gpu_graph`: "
+                    f"{', '.join(str(t) for t in targets)}"
+                )
+
+    @staticmethod
+    def _find_invocations(node: SfgCallTreeNode) -> list[SfgGpuKernelInvocation]:
+        if isinstance(node, SfgGpuKernelInvocation):
+            return [node]
+        return [
+            inv for c in node.children for inv in GpuGraphBuilder._find_invocations(c)
+        ]
+
+    @staticmethod
+    def _free_variables(node: SfgCallTreeNode, defined: set[SfgVar]) -> set[SfgVar]:
+        if isinstance(node, SfgDeferredNode):
+            raise SfgException(
+                "Deferred nodes (e.g. field mappings) cannot be placed inside `gpu_graph`."
+            )
+
+        free = node.depends - defined
+        if isinstance(node, SfgStatements):
+            defined |= node.defines
+
+        for c in node.children:
+            free |= GpuGraphBuilder._free_variables(c, defined)
+
+        return free
+
+    def _change_detectors(self, var: SfgVar) -> list[str]:
+        """Equality-comparable expressions covering the value of a variable read inside the graph.
+
+        Arithmetic types, pointers, and the runtime's stream and event handles are compared directly;
+        ``dim3`` values, which have no comparison operators, are compared member by member.
+        """
+        api = self._gpu_api
+        dtype = var.dtype.base_type if isinstance(var.dtype, Ref) else var.dtype
+
+        if isinstance(dtype, (PsNumericType, PsBoolType, PsPointerType)):
+            return [var.name]
+
+        def type_name(t: AugExpr) -> str:
+            return deconstify(t.get_dtype()).c_string().strip()
+
+        name = deconstify(dtype).c_string().strip()
+        if name == type_name(api.dim3()):
+            return [f"{var.name}.x", f"{var.name}.y", f"{var.name}.z"]
+        elif name in (type_name(api.stream_t()), type_name(api.event_t())):
+            return [var.name]
+        else:
+            raise SfgException(
+                f"Variable {var.name} of type {name} is read inside `gpu_graph`, "
+                "but changes of its value cannot be detected. "
+                "Only arithmetic types, pointers, `dim3`, streams, and events are supported."
+            )
+
+    def resolve(self) -> SfgCallTreeNode:
+        api = self._gpu_api
+        stream = self._stream
+
+        def stmt(fmt: str, *args: ExprLike) -> SfgStatements:
+            return make_statements(AugExpr.format(fmt, *args))
+
+        #   Kernel parameters and the variables mapped onto them may occur twice
+        free_vars = sorted(
+            {v.name: v for v in self._free_variables(self._body, set())}.values(),
+            key=lambda v: v.name,
+        )
+        detectors = [d for v in free_vars for d in self._change_detectors(v)]
+        params_now = AugExpr.make(
+            "std::make_tuple(" + ", ".join(detectors) + ")", free_vars
+        )
+
+        graph_exec = api.graph_exec_t().var("__graph_exec")
+        graph = api.graph_t().var("__graph")
+
+        setup = SfgStatements(
+            f"const auto __graph_params_now = {params_now};\n"
+            "static std::remove_const_t< decltype(__graph_params_now) > __graph_params {};\n"
+            f"static {graph_exec.get_dtype().c_string()} {graph_exec} {{ nullptr }};",
+            (asvar(graph_exec),),
+            free_vars,
+            includes(graph_exec)
+            | {HeaderFile.parse("<tuple>"), HeaderFile.parse("<type_traits>")},
+        )
+
+        recapture = make_sequence(
+            SfgStatements(
+                f"{graph.get_dtype().c_string()} {graph};",
+                (asvar(graph),),
+                (),
+                includes(graph),
+            ),
+            _checked_call(
+                api,
+                api.stream_begin_capture(stream),
+                "Beginning the capture of a GPU graph failed",
+            ),
+            #   Timing instrumentation must not be captured into the graph
+            SfgUnprofiledSequence([self._body]),
+            _checked_call(
+                api,
+                api.stream_end_capture(stream, graph),
+                "Capturing a GPU graph failed",
+            ),
+            SfgBranch(
+                stmt("{} != nullptr", graph_exec),
+                make_sequence(
+                    stmt(
+                        "const auto __graph_update_status = {};",
+                        api.graph_exec_update(graph_exec, graph),
+                    ),
+                    #   A changed graph topology cannot be updated in place;
+                    #   the executable graph is instantiated anew below
+                    SfgBranch(
+                        stmt("__graph_update_status == {}", api.graph_update_failure),
+                        make_sequence(
+                            stmt("{};", api.graph_exec_destroy(graph_exec)),
+                            stmt("{} = nullptr;", graph_exec),
+                        ),
+                        make_sequence(
+                            _checked_call(
+                                api,
+                                AugExpr.format("__graph_update_status"),
+                                "Updating a GPU graph failed",
+                            )
+                        ),
+                    ),
+                ),
+            ),
+            SfgBranch(
+                stmt("{} == nullptr", graph_exec),
+                make_sequence(
+                    _checked_call(
+                        api,
+                        api.graph_instantiate(graph_exec, graph),
+                        "Instantiating a GPU graph failed",
+                    )
+                ),
+            ),
+            stmt("{};", api.graph_destroy(graph)),
+            "__graph_params = __graph_params_now;",
+        )
+
+        return SfgBlock(
+            make_sequence(
+                setup,
+                SfgBranch(
+                    stmt(
+                        "{} == nullptr || __graph_params != __graph_params_now",
+                        graph_exec,
+                    ),
+                    recapture,
+                ),
+                _checked_call(
+                    api,
+                    api.graph_launch(graph_exec, stream),
+                    "Launching a GPU graph failed",
+                ),
+            )
+        )
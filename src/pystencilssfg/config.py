@@ -80,6 +80,29 @@ class ClangFormatOptions(ConfigBase):
     binary: BasicOption[str] = BasicOption("clang-format")
     """Path to the clang-format executable"""
 
+    jobs: BasicOption[int] = BasicOption()
+    """Maximum number of clang-format processes formatting the output files of a generator script concurrently.
+
+    If not set, the number of available CPUs is used.
+    """
+
+    cache: BasicOption[bool] = BasicOption(False)
+    """If set to ``True``, skip formatting output files whose unformatted code did not change since the last run.
+
+    The hashes of the unformatted and formatted code of each output file are stored
+    in the hidden directory ``.sfg-clang-format`` inside the output directory.
+    If the unformatted code and the existing output file both match their recorded hashes,
+    the file is left untouched without invoking clang-format.
+    """
+
+    @jobs.validate
+    def _validate_jobs(self, val: int | None) -> int | None:
+        if val is not None and val < 1:
+            raise SfgConfigException(
+                f"Number of clang-format jobs must be at least 1, but was {val}"
+            )
+        return val
+
     @force.validate
     def _validate_force(self, val: bool) -> bool:
         if val and self.skip:
@@ -97,6 +120,24 @@ class ClangFormatOptions(ConfigBase):
         return val
 
 
+@dataclass
+class ProfilingOptions(ConfigBase):
+    """Options controlling the profiling instrumentation of kernel call sites in the generated code."""
+
+    enable: BasicOption[bool] = BasicOption(False)
+    """If set to ``True``, wrap every kernel call and GPU kernel invocation in timing instrumentation.
+
+    The number of calls to each kernel and their accumulated run time are recorded in a registry
+    emitted into the generated header file.
+    If not set, no instrumentation code is generated at all.
+    """
+
+    gpu_ranges: BasicOption[bool] = BasicOption(False)
+    """If set to ``True``, additionally enclose each GPU kernel invocation in an NVTX (CUDA)
+    or roctx (HIP) range named after the kernel, for inspection in external profilers.
+    Has no effect unless `enable` is set."""
+
+
 class _GlobalNamespace: ...  # noqa: E701
 
 
@@ -123,6 +164,25 @@ class SfgConfig(ConfigBase):
     This will cause all definitions to be generated ``inline``.
     """
 
+    impl_shards: BasicOption[int] = BasicOption(1)
+    """Number of implementation files to distribute the generated definitions across.
+
+    If set to a value ``N > 1``, the definitions of kernels and functions are split
+    into ``N`` translation units of roughly equal size, which can be compiled in parallel.
+    The first translation unit is named as usual, while the others receive the suffixes
+    ``_shard1`` through ``_shard<N-1>`` (e.g. ``Kernels.cpp``, ``Kernels_shard1.cpp``, ...).
+    All declarations remain in the shared header file.
+    This option has no effect in header-only mode.
+    """
+
+    @impl_shards.validate
+    def _validate_impl_shards(self, n: int | None) -> int | None:
+        if n is not None and n < 1:
+            raise SfgConfigException(
+                f"Number of implementation file shards must be at least 1, but was {n}"
+            )
+        return n
+
     outer_namespace: BasicOption[str | _GlobalNamespace] = BasicOption(GLOBAL_NAMESPACE)
     """The outermost namespace in the generated file. May be a valid C++ nested namespace qualifier
     (like ``a::b::c``) or `GLOBAL_NAMESPACE` if no outer namespace should be generated.
@@ -150,6 +210,15 @@ class SfgConfig(ConfigBase):
             ClangFormatOptions.binary
     """
 
+    profiling: Category[ProfilingOptions] = Category(ProfilingOptions())
+    """Options for profiling the generated kernel calls
+
+    Options in this category:
+        .. autosummary::
+            ProfilingOptions.enable
+            ProfilingOptions.gpu_ranges
+    """
+
     output_directory: Option[Path, str | Path] = Option(Path("."))
     """Directory to which the generated files should be written."""
 
@@ -157,6 +226,19 @@ class SfgConfig(ConfigBase):
     def _validate_output_directory(self, pth: str | Path) -> Path:
         return Path(pth)
 
+    kernel_cache: Option[Path, str | Path] = Option()
+    """Directory of a persistent cache for kernels created through `sfg.kernels.create <KernelsAdder.create>`.
+
+    If set, each kernel created from a set of assignments and a code generator configuration
+    is stored in this directory, and loaded from there by subsequent generator runs instead of being recreated,
+    as long as its assignments, configuration, and the versions of pystencils and pystencils-sfg are unchanged.
+    The directory may be shared by all generator scripts of a project.
+    """
+
+    @kernel_cache.validate
+    def _validate_kernel_cache(self, pth: str | Path | None) -> Path | None:
+        return Path(pth) if pth is not None else None
+
     def _get_output_files(self, basename: str):
         output_dir: Path = self.get_option("output_directory")
 
@@ -169,6 +251,10 @@ class SfgConfig(ConfigBase):
             assert impl_ext is not None
             output_files.append(output_dir / f"{basename}.{impl_ext}")
 
+            num_shards = self.get_option("impl_shards")
+            for i in range(1, num_shards):
+                output_files.append(output_dir / f"{basename}_shard{i}.{impl_ext}")
+
         return tuple(output_files)
 
 
@@ -193,9 +279,30 @@ class CommandLineParameters:
             dest="header_only",
             help="Generate only a header file.",
         )
+        config_group.add_argument(
+            "--sfg-impl-shards",
+            type=int,
+            default=None,
+            dest="impl_shards",
+            help="Number of implementation files to split the generated definitions across.",
+        )
+        config_group.add_argument(
+            "--sfg-kernel-cache",
+            type=str,
+            default=None,
+            dest="kernel_cache",
+            help="Directory of a persistent cache for generated kernels.",
+        )
         config_group.add_argument(
             "--sfg-config-module", type=str, default=None, dest="config_module_path"
         )
+        config_group.add_argument(
+            "--sfg-profile",
+            action="store_true",
+            dest="sfg_profile",
+            help="Write a report of the time and memory spent in each phase of code generation "
+            "to <script>.sfg-profile.json in the output directory.",
+        )
 
         return parser
 
@@ -204,6 +311,9 @@ class CommandLineParameters:
 
         self._cl_header_only: bool | None = args.header_only
         self._cl_output_dir: str | None = args.output_directory
+        self._cl_impl_shards: int | None = args.impl_shards
+        self._cl_kernel_cache: str | None = args.kernel_cache
+        self._cl_profile: bool = args.sfg_profile
 
         if args.file_extensions is not None:
             file_extentions = list(args.file_extensions.split(","))
@@ -222,6 +332,11 @@ class CommandLineParameters:
         else:
             self._config_module = None
 
+    @property
+    def profile(self) -> bool:
+        """Whether the generator run should be profiled."""
+        return self._cl_profile
+
     @property
     def configuration_module(self) -> ModuleType | None:
         return self._config_module
@@ -241,6 +356,10 @@ class CommandLineParameters:
             cfg.extensions.impl = self._cl_impl_ext
         if self._cl_output_dir is not None:
             cfg.output_directory = self._cl_output_dir
+        if self._cl_impl_shards is not None:
+            cfg.impl_shards = self._cl_impl_shards
+        if self._cl_kernel_cache is not None:
+            cfg.kernel_cache = self._cl_kernel_cache
 
         return cfg
 
@@ -250,6 +369,8 @@ class CommandLineParameters:
             ("extensions.header", self._cl_header_ext, cfg.extensions.header),
             ("extensions.impl", self._cl_impl_ext, cfg.extensions.impl),
             ("output_directory", self._cl_output_dir, cfg.output_directory),
+            ("impl_shards", self._cl_impl_shards, cfg.impl_shards),
+            ("kernel_cache", self._cl_kernel_cache, cfg.kernel_cache),
         ):
             if mine is not None and theirs is not None and mine != theirs:
                 raise SfgConfigException(
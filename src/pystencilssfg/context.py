@@ -3,6 +3,7 @@ from typing import Sequence, Any, Generator
 from contextlib import contextmanager
 
 from .config import CodeStyle, ClangFormatOptions
+from .kernel_cache import KernelCache
 from .ir import (
     SfgSourceFile,
     SfgNamespace,
@@ -26,9 +27,11 @@ class SfgContext:
         clang_format_opts: ClangFormatOptions | None = None,
         argv: Sequence[str] | None = None,
         project_info: Any = None,
+        kernel_cache: KernelCache | None = None,
     ):
         self._argv = argv
         self._project_info = project_info
+        self._kernel_cache = kernel_cache
 
         self._outer_namespace = namespace
         self._inner_namespace: str | None = None
@@ -81,6 +84,11 @@ class SfgContext:
     def clang_format(self) -> ClangFormatOptions:
         return self._clang_format
 
+    @property
+    def kernel_cache(self) -> KernelCache | None:
+        """Persistent cache for kernels created in this context, if enabled."""
+        return self._kernel_cache
+
     @property
     def header_file(self) -> SfgSourceFile:
         return self._header_file
@@ -1,10 +1,85 @@
+from __future__ import annotations
+
+from typing import Sequence
+from concurrent.futures import ThreadPoolExecutor
+from functools import lru_cache
+from pathlib import Path
+
+import os
 import subprocess
 import shutil
+import tempfile
 
 from ..config import ClangFormatOptions
 from ..exceptions import SfgException
 
 
+@lru_cache(maxsize=None)
+def _find_binary(binary: str) -> str | None:
+    return shutil.which(binary)
+
+
+def clang_format_style_file(options: ClangFormatOptions) -> Path | None:
+    """The ``.clang-format`` file used by clang-format runs with the given options, if any.
+
+    If the code style is ``file``, this is the style file clang-format discovers when formatting
+    from standard input, i.e. the first ``.clang-format`` or ``_clang-format`` file
+    in the current working directory or any of its parents.
+    """
+    if options.get_option("code_style") != "file":
+        return None
+
+    cwd = Path.cwd()
+    for directory in (cwd, *cwd.parents):
+        for name in (".clang-format", "_clang-format"):
+            if (directory / name).is_file():
+                return directory / name
+
+    return None
+
+
+def clang_format_args(
+    options: ClangFormatOptions, sort_includes: str | None = None
+) -> list[str] | None:
+    """Command line of the `clang-format` invocation described by the given options.
+
+    Returns:
+        The clang-format command line, or `None` if formatting is skipped
+        or the clang-format binary cannot be found.
+
+    Raises:
+        SfgException: If formatting is forced, but the clang-format binary could not be found.
+    """
+    if options.get_option("skip"):
+        return None
+
+    binary = options.get_option("binary")
+    force = options.get_option("force")
+    style = options.get_option("code_style")
+
+    binary_path = _find_binary(binary)
+    if binary_path is None:
+        if force:
+            raise SfgException(
+                "`force_clang_format` was set to true in code style, "
+                "but clang-format binary could not be found."
+            )
+        else:
+            return None
+
+    #   Pass the style file explicitly, such that it does not depend on the location of formatted files
+    style_file = clang_format_style_file(options)
+    if style_file is not None:
+        style = f"file:{style_file}"
+
+    args = [binary_path, f"--style={style}"]
+
+    if sort_includes is not None:
+        args += ["--sort-includes", sort_includes]
+
+    return args
+
+
 def invoke_clang_format(
     code: str, options: ClangFormatOptions, sort_includes: str | None = None
 ) -> str:
@@ -26,32 +101,88 @@ def invoke_clang_format(
         be executed (binary not found, or error during exection), the function will
         throw an exception.
     """
-    if options.get_option("skip"):
+    args = clang_format_args(options, sort_includes)
+    if args is None:
         return code
 
-    binary = options.get_option("binary")
-    force = options.get_option("force")
-    style = options.get_option("code_style")
-    args = [binary, f"--style={style}"]
-
-    if sort_includes is not None:
-        args += ["--sort-includes", sort_includes]
-
-    if not shutil.which(binary):
-        if force:
-            raise SfgException(
-                "`force_clang_format` was set to true in code style, "
-                "but clang-format binary could not be found."
-            )
-        else:
-            return code
-
     result = subprocess.run(args, input=code, capture_output=True, text=True)
 
     if result.returncode != 0:
-        if force:
+        if options.get_option("force"):
             raise SfgException(f"Call to clang-format failed: \n{result.stderr}")
         else:
             return code
 
     return result.stdout
+
+
+def invoke_clang_format_batch(
+    files: Sequence[tuple[str, str]],
+    options: ClangFormatOptions,
+    sort_includes: str | None = None,
+) -> list[str]:
+    """Format several code strings using as few `clang-format` invocations as possible.
+
+    The code strings are written to a temporary directory,
+    using the same style file as when formatting from standard input (see `clang_format_style_file`).
+    They are then formatted in place by at most `ClangFormatOptions.jobs` concurrent clang-format processes,
+    each of which receives a share of the files on its command line.
+
+    Args:
+        files: Sequence of pairs of file name and code string; the file names' extensions
+            determine the language clang-format assumes for each file
+        options: Options controlling the clang-format invocation
+        sort_includes: Option to be passed on to clang-format's ``--sort-includes`` argument
+
+    Returns:
+        The formatted code strings, in the order of ``files``.
+        Code strings which could not be formatted are returned unchanged,
+        unless formatting was forced; see `invoke_clang_format`.
+    """
+    if len(files) <= 1:
+        return [invoke_clang_format(code, options, sort_includes) for _, code in files]
+
+    args = clang_format_args(options, sort_includes)
+    if args is None:
+        return [code for _, code in files]
+
+    force = options.get_option("force")
+    jobs = options.get_option("jobs") or os.cpu_count() or 1
+    jobs = max(1, min(jobs, len(files)))
+
+    with tempfile.TemporaryDirectory(prefix="sfg-clang-format-") as tmpdir_name:
+        paths: list[Path] = []
+        for i, (name, code) in enumerate(files):
+            #   Prefix with the index to keep the names of files from different directories distinct
+            fpath = Path(tmpdir_name) / f"{i}_{Path(name).name}"
+            fpath.write_text(code)
+            paths.append(fpath)
+
+        chunks = [paths[j::jobs] for j in range(jobs)]
+
+        def run(chunk: list[Path]) -> subprocess.CompletedProcess:
+            return subprocess.run(
+                args + ["-i"] + [str(p) for p in chunk],
+                capture_output=True,
+                text=True,
+            )
+
+        if jobs == 1:
+            results = [run(chunks[0])]
+        else:
+            with ThreadPoolExecutor(max_workers=jobs) as pool:
+                results = list(pool.map(run, chunks))
+
+        failed: set[Path] = set()
+        for chunk, result in zip(chunks, results):
+            if result.returncode != 0:
+                if force:
+                    raise SfgException(
+                        f"Call to clang-format failed: \n{result.stderr}"
+                    )
+                failed.update(chunk)
+
+        return [
+            code if fpath in failed else fpath.read_text()
+            for fpath, (_, code) in zip(paths, files)
+        ]
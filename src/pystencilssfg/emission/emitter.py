@@ -1,15 +1,33 @@
 from __future__ import annotations
 
+from typing import Sequence
 from pathlib import Path
 
+import hashlib
+import os
+import tempfile
+
 from ..config import CodeStyle, ClangFormatOptions
+from ..generator_profile import profile_phase
 from ..ir import SfgSourceFile
+from ..ir.syntax import SfgNamespaceElement
 
 from .file_printer import SfgFilePrinter
-from .clang_format import invoke_clang_format
+from .clang_format import (
+    clang_format_args,
+    clang_format_style_file,
+    invoke_clang_format,
+    invoke_clang_format_batch,
+)
+
+
+def _sha256(text: str) -> str:
+    return hashlib.sha256(text.encode()).hexdigest()
 
 
 class SfgCodeEmitter:
+    FORMAT_CACHE_DIR = ".sfg-clang-format"
+
     def __init__(
         self,
         output_directory: Path,
@@ -21,22 +39,124 @@ class SfgCodeEmitter:
         self._clang_format_opts = clang_format
         self._printer = SfgFilePrinter(code_style)
 
-    def dumps(self, file: SfgSourceFile) -> str:
-        code = self._printer(file)
-
+    def _sort_includes(self) -> str | None:
         if self._code_style.get_option("includes_sorting_key") is not None:
-            sort_includes = "Never"
+            return "Never"
         else:
-            sort_includes = None
+            return None
 
-        code = invoke_clang_format(
-            code, self._clang_format_opts, sort_includes=sort_includes
-        )
+    def dumps(self, file: SfgSourceFile) -> str:
+        with profile_phase("print", file.name):
+            code = self._printer(file)
+
+        with profile_phase("clang_format", file.name):
+            code = invoke_clang_format(
+                code, self._clang_format_opts, sort_includes=self._sort_includes()
+            )
 
         return code
 
-    def emit(self, file: SfgSourceFile):
-        code = self.dumps(file)
+    def estimate_size(self, elem: SfgNamespaceElement) -> int:
+        """Estimate the size of the given code element as the length of its unformatted code."""
+        return len(self._printer.visit(elem))
+
+    def emit(self, file: SfgSourceFile) -> bool:
+        """Print, format and write the given file to the output directory.
+
+        If the file already exists and its content is identical to the newly generated code,
+        it is left untouched, such that its modification time is preserved
+        and dependent build targets are not needlessly recompiled.
+
+        Returns:
+            `True` if the file was written, and `False` if it was already up to date.
+        """
+        return self.emit_all([file])[0]
+
+    def emit_all(self, files: Sequence[SfgSourceFile]) -> list[bool]:
+        """Print, format and write several files to the output directory.
+
+        All files are formatted together through `invoke_clang_format_batch`.
+        Otherwise, behaves like `emit` for each file.
+
+        Returns:
+            For each file, whether it was written.
+        """
         self._output_dir.mkdir(parents=True, exist_ok=True)
-        fpath = self._output_dir / file.name
+
+        codes: list[str] = []
+        for file in files:
+            with profile_phase("print", file.name):
+                codes.append(self._printer(file))
+
+        sort_includes = self._sort_includes()
+        cache_keys: list[str | None] = [None] * len(files)
+        if self._clang_format_opts.get_option("cache"):
+            args = clang_format_args(self._clang_format_opts, sort_includes)
+            if args is not None:
+                #   The formatted code also depends on the contents of the style file
+                style_file = clang_format_style_file(self._clang_format_opts)
+                if style_file is not None:
+                    args = args + [_sha256(style_file.read_text())]
+                cache_keys = [_sha256("\0".join(args + [code])) for code in codes]
+
+        written = [False] * len(files)
+        to_format: list[int] = []
+        for i, file in enumerate(files):
+            if cache_keys[i] is not None and self._is_cached(file.name, cache_keys[i]):
+                continue
+            to_format.append(i)
+
+        #   A single profile entry covers all files formatted together
+        formatted: list[str] = []
+        if to_format:
+            with profile_phase("clang_format", ", ".join(files[i].name for i in to_format)):
+                formatted = invoke_clang_format_batch(
+                    [(files[i].name, codes[i]) for i in to_format],
+                    self._clang_format_opts,
+                    sort_includes=sort_includes,
+                )
+
+        for i, code in zip(to_format, formatted):
+            written[i] = self._write_if_changed(files[i].name, code)
+            if (key := cache_keys[i]) is not None:
+                self._store_cache_entry(files[i].name, key, code)
+
+        return written
+
+    def _write_if_changed(self, name: str, code: str) -> bool:
+        fpath = self._output_dir / name
+
+        if fpath.is_file():
+            try:
+                if fpath.read_text() == code:
+                    return False
+            except (OSError, UnicodeDecodeError):
+                pass
+
         fpath.write_text(code)
+        return True
+
+    def _cache_entry(self, name: str) -> Path:
+        return self._output_dir / self.FORMAT_CACHE_DIR / f"{name}.sha256"
+
+    def _is_cached(self, name: str, key: str) -> bool:
+        """Check whether the output file ``name`` is the formatted form of the code hashed by ``key``."""
+        try:
+            recorded_key, recorded_hash = self._cache_entry(name).read_text().split()
+            if recorded_key != key:
+                return False
+            return _sha256((self._output_dir / name).read_text()) == recorded_hash
+        except (OSError, UnicodeDecodeError, ValueError):
+            return False
+
+    def _store_cache_entry(self, name: str, key: str, formatted_code: str):
+        entry = self._cache_entry(name)
+        try:
+            entry.parent.mkdir(parents=True, exist_ok=True)
+            #   Write atomically, such that concurrent runs never observe partial entries
+            fd, tmp_path = tempfile.mkstemp(dir=entry.parent, suffix=".tmp")
+            with os.fdopen(fd, "w") as f:
+                f.write(f"{key} {_sha256(formatted_code)}\n")
+            os.replace(tmp_path, entry)
+        except OSError:
+            pass
@@ -17,19 +17,34 @@ from ..composer import (
     SfgComposer,
     SfgComposerMixIn,
     make_sequence,
+    make_statements,
 )
 from ..ir import (
     SfgKernelHandle,
     SfgCallTreeNode,
     SfgCallTreeLeaf,
     SfgKernelCallNode,
+    SfgSequence,
+    SfgStatements,
 )
 
-from ..lang import SfgVar, AugExpr, cpptype, Ref, VarLike, _VarLike, asvar
-from ..lang.cpp.sycl_accessor import SyclAccessor
+from ..lang import (
+    SfgVar,
+    AugExpr,
+    cpptype,
+    Ref,
+    VarLike,
+    _VarLike,
+    asvar,
+    includes,
+)
+from ..lang.cpp.sycl_accessor import SyclAccessor, SyclLocalAccessor
+from ..lang.cpp.sycl_usm import SyclUsmPointer
 
 
 accessor = SyclAccessor
+local_accessor = SyclLocalAccessor
+usm_pointer = SyclUsmPointer
 
 
 class SyclComposerMixIn(SfgComposerMixIn):
@@ -46,6 +61,132 @@ class SyclComposerMixIn(SfgComposerMixIn):
     def sycl_range(self, dims: int, name: str, ref: bool = False) -> SyclRange:
         return SyclRange(dims, ref=ref).var(name)
 
+    def sycl_nd_range(self, dims: int, name: str, ref: bool = False) -> SyclNdRange:
+        """Obtain a `SyclNdRange`, which represents a ``sycl::nd_range`` object."""
+        return SyclNdRange(dims, ref=ref).var(name)
+
+    def sycl_submit_kernels(
+        self,
+        queue: SyclQueue,
+        kernels: Sequence[
+            SfgKernelHandle | tuple[SfgKernelHandle, VarLike | Sequence[int]]
+        ],
+        range: VarLike | Sequence[int] | None = None,
+        *,
+        mappings: Sequence[SequencerArg] = (),
+        depends_on: Sequence[VarLike] = (),
+        wait: bool = True,
+    ) -> SfgSequence:
+        """Submit a sequence of SYCL kernels to a queue, ordering them through explicit event dependencies.
+
+        The kernels are submitted in the given order using `SyclQueue.parallel_for`.
+        Each kernel waits only for those previously submitted kernels whose field accesses conflict with its own,
+        i.e. which write a field it reads or writes, or read a field it writes.
+        Fields whose pointers are ``const``-qualified in the kernel's signature are considered read-only.
+        Independent kernels, such as boundary updates on disjoint faces, may thus execute concurrently
+        on an out-of-order queue.
+
+        :Example:
+
+            Given a queue object ``queue`` and handles to the kernels ``collide``, ``stream``,
+            ``boundary_west`` and ``boundary_east``:
+
+            .. code-block:: Python
+
+                sfg.function("timestep")(
+                    sfg.sycl_submit_kernels(
+                        queue,
+                        [collide, (boundary_west, west_range), (boundary_east, east_range), stream],
+                        range=domain_range,
+                        mappings=[sfg.map_field(f, sycl.usm_pointer.from_field(f)), ...],
+                    )
+                )
+
+        Args:
+            queue: The queue to submit the kernels to
+            kernels: Sequence of kernel handles, or pairs of kernel handle and iteration range
+            range: Default iteration range for all kernels given without an explicit range
+            mappings: Field mappings (see `map_field <SfgBasicComposer.map_field>`) to be placed
+                in the body of each kernel, e.g. to extract the kernels' fields from USM pointers
+            depends_on: Events that must complete before any of the kernels may start
+            wait: If `True`, wait for all submitted kernels to complete before returning
+        """
+        steps: list[tuple[SfgKernelHandle, VarLike | Sequence[int]]] = []
+        for item in kernels:
+            if isinstance(item, SfgKernelHandle):
+                if range is None:
+                    raise ValueError(
+                        f"No iteration range given for kernel {item.fqname}"
+                    )
+                steps.append((item, range))
+            else:
+                steps.append(item)
+
+        if not steps:
+            raise ValueError("At least one kernel must be given.")
+
+        accesses = [_field_accesses(khandle) for khandle, _ in steps]
+        events = [
+            SyclEvent().var(f"__{khandle.name}_done_{i}")
+            for i, (khandle, _) in enumerate(steps)
+        ]
+
+        #   Direct dependencies on previously submitted kernels
+        preds: list[set[int]] = []
+        for j, (reads_j, writes_j) in enumerate(accesses):
+            preds_j = {
+                i
+                for i, (reads_i, writes_i) in enumerate(accesses[:j])
+                if (writes_i & (reads_j | writes_j)) or (reads_i & writes_j)
+            }
+            preds.append(preds_j)
+
+        #   Transitive closure, to elide dependencies implied by others
+        ancestors: list[set[int]] = []
+        for preds_j in preds:
+            ancestors.append(preds_j.union(*(ancestors[i] for i in preds_j)))
+
+        nodes: list[SfgCallTreeNode] = []
+        has_successor: set[int] = set()
+        for j, (khandle, krange) in enumerate(steps):
+            direct = {
+                i for i in preds[j] if not any(i in ancestors[k] for k in preds[j])
+            }
+            has_successor |= direct
+            dep_events = [events[i] for i in sorted(direct)]
+            if not preds[j]:
+                dep_events = list(depends_on) + dep_events
+
+            invoke = queue.parallel_for(krange, depends_on=dep_events, event=events[j])(
+                *mappings, SfgKernelCallNode(khandle)
+            )
+            nodes.append(invoke)
+
+        if wait:
+            sinks = [ev for i, ev in enumerate(events) if i not in has_successor]
+            nodes.append(
+                make_statements(
+                    AugExpr.format(
+                        "sycl::event::wait({{ "
+                        + ", ".join("{}" for _ in sinks)
+                        + " }});",
+                        *sinks,
+                    )
+                )
+            )
+
+        return SfgSequence(nodes)
+
+    def sycl_queue(self, name: str) -> SyclQueue:
+        """Obtain a `SyclQueue`, which represents a ``sycl::queue`` object."""
+        return SyclQueue(self._ctx).var(name)
+
+    def sycl_event(
+        self, name: str, const: bool = False, ref: bool = False
+    ) -> SyclEvent:
+        """Obtain a `SyclEvent`, which represents a ``sycl::event`` object."""
+        return SyclEvent(const=const, ref=ref).var(name)
+
 
 class SyclComposer(SfgBasicComposer, SfgClassComposer, SyclComposerMixIn):
     """Composer extension providing SYCL code generation capabilities"""
@@ -62,6 +203,14 @@ class SyclRange(AugExpr):
         super().__init__(dtype)
 
 
+class SyclNdRange(AugExpr):
+    _template = cpptype("sycl::nd_range< {dims} >", "<sycl/sycl.hpp>")
+
+    def __init__(self, dims: int, const: bool = False, ref: bool = False):
+        dtype = self._template(dims=dims, const=const, ref=ref)
+        super().__init__(dtype)
+
+
 class SyclHandler(AugExpr):
     """Represents a SYCL command group handler (``sycl::handler``)."""
 
@@ -76,6 +225,11 @@ class SyclHandler(AugExpr):
     def parallel_for(
         self,
         range: VarLike | Sequence[int],
+        local_range: VarLike | Sequence[int] | None = None,
+        *,
+        local_memory: Sequence[tuple[AugExpr, VarLike | Sequence[int]]] = (),
+        reqd_work_group_size: Sequence[int] | None = None,
+        reqd_sub_group_size: int | None = None,
     ):
         """Generate a ``parallel_for`` kernel invocation using this command group handler.
         The syntax of this uses a chain of two calls to mimic C++ syntax:
@@ -88,48 +242,258 @@ class SyclHandler(AugExpr):
 
         The body is constructed via sequencing (see `make_sequence`).
 
+        If a ``local_range`` is given, or ``range`` is a `SyclNdRange`,
+        the kernel is launched over a ``sycl::nd_range``.
+        In this case, all kernels in the body must take a ``sycl::nd_item`` as their index parameter,
+        i.e. they must have been generated with ``cfg.sycl.automatic_block_size = False``.
+
         Args:
             range: Object, or tuple of integers, indicating the kernel's iteration range
+            local_range: Object, or tuple of integers, indicating the work-group size of an ``nd_range`` launch
+            local_memory: Sequence of pairs ``(accessor, range)`` of `local accessors <SyclLocalAccessor>`
+                and their extents; these are allocated for each work-group before the kernel launch.
+            reqd_work_group_size: If set, mark the kernel as requiring the given work-group size
+                using the ``sycl::reqd_work_group_size`` attribute
+            reqd_sub_group_size: If set, mark the kernel as requiring the given sub-group size
+                using the ``sycl::reqd_sub_group_size`` attribute
         """
-        if isinstance(range, _VarLike):
-            range = asvar(range)
+        return _parallel_for_sequencer(
+            self,
+            SyclInvokeType.ParallelFor,
+            range,
+            local_range,
+            local_memory=local_memory,
+            reqd_work_group_size=reqd_work_group_size,
+            reqd_sub_group_size=reqd_sub_group_size,
+        )
 
-        def check_kernel(khandle: SfgKernelHandle):
-            kfunc = khandle.kernel
-            if kfunc.target != Target.SYCL:
-                raise SfgException(
-                    f"Kernel given to `parallel_for` is no SYCL kernel: {khandle.fqname}"
-                )
 
-        id_regex = re.compile(r"sycl::(id|item|nd_item)<\s*[0-9]\s*>")
+class SyclEvent(AugExpr):
+    """Represents a SYCL event (``sycl::event``)."""
 
-        def filter_id(param: SfgVar) -> bool:
-            return (
-                isinstance(param.dtype, PsCustomType)
-                and id_regex.search(param.dtype.c_string()) is not None
+    _type = cpptype("sycl::event", "<sycl/sycl.hpp>")
+
+    def __init__(self, const: bool = False, ref: bool = False):
+        dtype = self._type(const=const, ref=ref)
+        super().__init__(dtype)
+
+
+class SyclQueue(AugExpr):
+    """Represents a SYCL queue (``sycl::queue``).
+
+    Kernels submitted directly to a queue, using the shortcut functions of ``sycl::queue``,
+    do not take part in the buffer/accessor dependency tracking of the SYCL runtime.
+    They are therefore best combined with `USM pointers <SyclUsmPointer>`,
+    and must be ordered through explicit ``sycl::event`` dependencies.
+    """
+
+    _type = cpptype("sycl::queue", "<sycl/sycl.hpp>")
+
+    def __init__(self, ctx: SfgContext):
+        dtype = Ref(self._type())
+        super().__init__(dtype)
+
+        self._ctx = ctx
+
+    def parallel_for(
+        self,
+        range: VarLike | Sequence[int],
+        local_range: VarLike | Sequence[int] | None = None,
+        *,
+        depends_on: Sequence[VarLike] = (),
+        event: VarLike | None = None,
+        reqd_work_group_size: Sequence[int] | None = None,
+        reqd_sub_group_size: int | None = None,
+    ):
+        """Generate a ``parallel_for`` kernel submission on this queue.
+
+        The kernel body is constructed in the same way as in `SyclHandler.parallel_for`.
+
+        Args:
+            range: Object, or tuple of integers, indicating the kernel's iteration range
+            local_range: Object, or tuple of integers, indicating the work-group size of an ``nd_range`` launch
+            depends_on: Events the kernel must wait for before execution
+            event: If set, the ``sycl::event`` returned by the submission is stored in a new variable
+                with this name and type, which can be passed in the ``depends_on`` list of later kernels.
+            reqd_work_group_size: If set, mark the kernel as requiring the given work-group size
+            reqd_sub_group_size: If set, mark the kernel as requiring the given sub-group size
+        """
+        return _parallel_for_sequencer(
+            self,
+            SyclInvokeType.QueueParallelFor,
+            range,
+            local_range,
+            depends_on=depends_on,
+            event=event,
+            reqd_work_group_size=reqd_work_group_size,
+            reqd_sub_group_size=reqd_sub_group_size,
+        )
+
+
+def _parallel_for_sequencer(
+    invoker: SyclHandler | SyclQueue,
+    invoke_type: SyclInvokeType,
+    range: VarLike | Sequence[int],
+    local_range: VarLike | Sequence[int] | None = None,
+    *,
+    local_memory: Sequence[tuple[AugExpr, VarLike | Sequence[int]]] = (),
+    depends_on: Sequence[VarLike] = (),
+    event: VarLike | None = None,
+    reqd_work_group_size: Sequence[int] | None = None,
+    reqd_sub_group_size: int | None = None,
+):
+    nd_range = local_range is not None or isinstance(range, SyclNdRange)
+
+    if isinstance(range, _VarLike):
+        range = asvar(range)
+
+    if isinstance(local_range, _VarLike):
+        local_range = asvar(local_range)
+
+    if not nd_range and (local_memory or reqd_work_group_size is not None):
+        raise ValueError(
+            "Local memory and required work-group sizes are only available for `nd_range` launches."
+        )
+
+    if reqd_work_group_size is not None:
+        reqd_work_group_size = tuple(reqd_work_group_size)
+        if (
+            isinstance(local_range, tuple | list)
+            and tuple(local_range) != reqd_work_group_size
+        ):
+            raise ValueError(
+                f"Required work-group size {reqd_work_group_size} does not match local range {local_range}"
             )
 
-        def sequencer(*args: SequencerArg):
-            id_param = []
-            for arg in args:
-                if isinstance(arg, SfgKernelCallNode):
-                    check_kernel(arg._kernel_handle)
-                    id_param.append(
-                        list(filter(filter_id, arg._kernel_handle.scalar_parameters))[0]
-                    )
+    attributes: list[str] = []
+    if reqd_work_group_size is not None:
+        wg_size = ", ".join(str(s) for s in reqd_work_group_size)
+        attributes.append(f"sycl::reqd_work_group_size({wg_size})")
+    if reqd_sub_group_size is not None:
+        attributes.append(f"sycl::reqd_sub_group_size({reqd_sub_group_size})")
+
+    local_mem_decls: list[SfgStatements] = []
+    for acc, acc_range in local_memory:
+        if not isinstance(acc, SyclLocalAccessor):
+            raise ValueError(
+                f"Local memory must be given as `sycl.local_accessor` objects, but got {acc}"
+            )
+        acc_var = asvar(acc)
+        acc_range_code, acc_range_deps = _range_code(
+            acc_range, f"sycl::range< {acc.dimensions} >"
+        )
+        acc_decl = f"{acc_var.dtype.c_string()} {acc_var.name}"
+        local_mem_decls.append(
+            SfgStatements(
+                f"{acc_decl} {{ {acc_range_code}, {invoker} }};",
+                (acc_var,),
+                acc_range_deps | invoker.depends,
+                includes(acc),
+            )
+        )
+
+    dep_events = tuple(asvar(e) for e in depends_on)
+    event_var = asvar(event) if event is not None else None
 
-            if not all(item == id_param[0] for item in id_param):
-                raise ValueError(
-                    "id_param should be the same for all kernels in parallel_for"
+    def check_kernel(khandle: SfgKernelHandle):
+        kfunc = khandle.kernel
+        if kfunc.target != Target.SYCL:
+            raise SfgException(
+                f"Kernel given to `parallel_for` is no SYCL kernel: {khandle.fqname}"
+            )
+
+    if nd_range:
+        id_regex = re.compile(r"sycl::nd_item<\s*([0-9])\s*>")
+    else:
+        id_regex = re.compile(r"sycl::(id|item|nd_item)<\s*([0-9])\s*>")
+
+    def filter_id(param: SfgVar) -> bool:
+        return (
+            isinstance(param.dtype, PsCustomType)
+            and id_regex.search(param.dtype.c_string()) is not None
+        )
+
+    def sequencer(*args: SequencerArg):
+        id_param = []
+        for arg in args:
+            if isinstance(arg, SfgKernelCallNode):
+                check_kernel(arg._kernel_handle)
+                id_candidates = list(
+                    filter(filter_id, arg._kernel_handle.scalar_parameters)
                 )
-            tree = make_sequence(*args)
+                if not id_candidates:
+                    raise SfgException(
+                        f"Kernel {arg._kernel_handle.fqname} does not take a "
+                        + ("`sycl::nd_item`" if nd_range else "SYCL index")
+                        + " parameter"
+                    )
+                id_param.append(id_candidates[0])
 
-            kernel_lambda = SfgLambda(("=",), (id_param[0],), tree, None)
-            return SyclKernelInvoke(
-                self, SyclInvokeType.ParallelFor, range, kernel_lambda
+        if not all(item == id_param[0] for item in id_param):
+            raise ValueError(
+                "id_param should be the same for all kernels in parallel_for"
             )
+        tree = make_sequence(*args)
+
+        kernel_lambda = SfgLambda(
+            ("=",), (id_param[0],), tree, None, attributes=attributes
+        )
+
+        dims: int | None = None
+        if nd_range and local_range is not None:
+            id_match = id_regex.search(id_param[0].dtype.c_string())
+            assert id_match is not None
+            dims = int(id_match.groups()[-1])
+
+        invoke = SyclKernelInvoke(
+            invoker,
+            invoke_type,
+            range,
+            kernel_lambda,
+            local_range=local_range if nd_range else None,
+            dims=dims,
+            depends_on=dep_events,
+            event=event_var,
+        )
 
-        return sequencer
+        if local_mem_decls:
+            return SfgSequence(local_mem_decls + [invoke])
+        else:
+            return invoke
+
+    return sequencer
+
+
+def _field_accesses(khandle: SfgKernelHandle) -> tuple[set[str], set[str]]:
+    """Determine the names of the fields read and written by the given kernel."""
+    from pystencils.codegen.properties import FieldBasePtr
+    from pystencils.types import PsPointerType
+
+    reads: set[str] = set()
+    writes: set[str] = set()
+    for param in khandle.parameters:
+        for prop in param.wrapped.properties:
+            if isinstance(prop, FieldBasePtr):
+                reads.add(prop.field.name)
+                dtype = param.dtype
+                if isinstance(dtype, PsPointerType) and not dtype.base_type.const:
+                    writes.add(prop.field.name)
+    return reads, writes
+
+
+def _range_code(
+    range: SfgVar | Sequence[int] | VarLike, range_type: str | None = None
+) -> tuple[str, set[SfgVar]]:
+    if isinstance(range, _VarLike):
+        range = asvar(range)
+
+    if isinstance(range, SfgVar):
+        return range.name, {range}
+    else:
+        braced = "{ " + ", ".join(str(r) for r in range) + " }"
+        if range_type is not None:
+            braced = range_type + braced
+        return braced, set()
 
 
 class SyclGroup(AugExpr):
@@ -195,10 +559,12 @@ class SfgLambda:
         params: Sequence[SfgVar],
         tree: SfgCallTreeNode,
         return_type: UserTypeSpec | None = None,
+        attributes: Sequence[str] = (),
     ) -> None:
         self._captures = tuple(captures)
         self._params = tuple(params)
         self._tree = tree
+        self._attributes = tuple(attributes)
         self._return_type: PsType | None = (
             create_type(return_type) if return_type is not None else None
         )
@@ -226,6 +592,11 @@ class SfgLambda:
     def return_type(self) -> PsType | None:
         return self._return_type
 
+    @property
+    def attributes(self) -> tuple[str, ...]:
+        """Attributes attached to the lambda's function call operator"""
+        return self._attributes
+
     @property
     def required_parameters(self) -> set[SfgVar]:
         return self._required_params
@@ -235,18 +606,22 @@ class SfgLambda:
         params = ", ".join(f"{p.dtype.c_string()} {p.name}" for p in self._params)
         body = self._tree.get_code(cstyle)
         body = cstyle.indent(body)
+        attrs = (
+            "[[" + ", ".join(self._attributes) + "]] " if self._attributes else ""
+        )
         rtype = (
             f"-> {self._return_type.c_string()} "
             if self._return_type is not None
             else ""
         )
 
-        return f"[{captures}] ({params}) {rtype}{{\n{body}\n}}"
+        return f"[{captures}] ({params}) {attrs}{rtype}{{\n{body}\n}}"
 
 
 class SyclInvokeType(Enum):
     ParallelFor = ("parallel_for", SyclHandler)
     ParallelForWorkItem = ("parallel_for_work_item", SyclGroup)
+    QueueParallelFor = ("parallel_for", SyclQueue)
 
     @property
     def method(self) -> str:
@@ -266,25 +641,50 @@ class SyclKernelInvoke(SfgCallTreeLeaf):
         invoke_type: SyclInvokeType,
         range: SfgVar | Sequence[int],
         lamb: SfgLambda,
+        local_range: SfgVar | Sequence[int] | None = None,
+        dims: int | None = None,
+        depends_on: Sequence[SfgVar] = (),
+        event: SfgVar | None = None,
     ):
         if not isinstance(invoker, invoke_type.invoker_class):
             raise SfgException(
                 f"Cannot invoke kernel via `{invoke_type.method}` on a {type(invoker)}"
             )
 
+        if (depends_on or event is not None) and not isinstance(invoker, SyclQueue):
+            raise SfgException(
+                "Event dependencies can only be specified for kernels submitted to a queue"
+            )
+
         super().__init__()
         self._invoker = invoker
         self._invoke_type = invoke_type
         self._range: SfgVar | tuple[int, ...] = (
             range if isinstance(range, SfgVar) else tuple(range)
         )
+        self._local_range: SfgVar | tuple[int, ...] | None = (
+            local_range
+            if local_range is None or isinstance(local_range, SfgVar)
+            else tuple(local_range)
+        )
         self._lambda = lamb
 
+        if self._local_range is not None and dims is None:
+            raise ValueError("Dimensionality of `nd_range` launch must be specified")
+        self._dims = dims
+
+        self._depends_on = tuple(depends_on)
+        self._event = event
+
         self._required_params = set(invoker.depends | lamb.required_parameters)
+        self._required_params |= set(self._depends_on)
 
         if isinstance(range, SfgVar):
             self._required_params.add(range)
 
+        if isinstance(local_range, SfgVar):
+            self._required_params.add(local_range)
+
     @property
     def invoker(self) -> SyclHandler | SyclGroup:
         return self._invoker
@@ -293,22 +693,55 @@ class SyclKernelInvoke(SfgCallTreeLeaf):
     def range(self) -> SfgVar | tuple[int, ...]:
         return self._range
 
+    @property
+    def local_range(self) -> SfgVar | tuple[int, ...] | None:
+        return self._local_range
+
     @property
     def kernel(self) -> SfgLambda:
         return self._lambda
 
+    @property
+    def depends_on(self) -> tuple[SfgVar, ...]:
+        """Events this kernel invocation waits for"""
+        return self._depends_on
+
+    @property
+    def event(self) -> SfgVar | None:
+        """Variable receiving the event returned by the kernel submission"""
+        return self._event
+
     @property
     def depends(self) -> set[SfgVar]:
         return self._required_params
 
+    @property
+    def defines(self) -> set[SfgVar]:
+        return {self._event} if self._event is not None else set()
+
     def get_code(self, cstyle: CodeStyle) -> str:
-        if isinstance(self._range, SfgVar):
-            range_code = self._range.name
+        if self._local_range is not None:
+            range_type = f"sycl::range< {self._dims} >"
+            global_code, _ = _range_code(self._range, range_type)
+            local_code, _ = _range_code(self._local_range, range_type)
+            range_code = (
+                f"sycl::nd_range< {self._dims} >{{ {global_code}, {local_code} }}"
+            )
         else:
-            range_code = "{ " + ", ".join(str(r) for r in self._range) + " }"
+            range_code, _ = _range_code(self._range)
 
         kernel_code = self._lambda.get_code(cstyle)
         invoker = str(self._invoker)
         method = self._invoke_type.method
 
-        return f"{invoker}.{method}({range_code}, {kernel_code});"
+        args = [range_code]
+        if len(self._depends_on) == 1:
+            args.append(self._depends_on[0].name)
+        elif self._depends_on:
+            args.append("{ " + ", ".join(e.name for e in self._depends_on) + " }")
+        args.append(kernel_code)
+
+        code = f"{invoker}.{method}({', '.join(args)});"
+        if self._event is not None:
+            code = f"{self._event.dtype.c_string()} {self._event.name} = " + code
+        return code
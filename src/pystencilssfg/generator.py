@@ -7,6 +7,8 @@ from .config import (
     _GlobalNamespace,
 )
 from .context import SfgContext
+from .generator_profile import GeneratorProfile, activate_profile, profile_phase
+from .kernel_cache import KernelCache
 from .composer import SfgComposer
 from .emission import SfgCodeEmitter
 from .exceptions import SfgException
@@ -70,12 +72,19 @@ class SourceFileGenerator:
             sfg_args = parser.parse_args()
             script_args = []
 
-        cli_params = CommandLineParameters(sfg_args)
+        self._profile: GeneratorProfile | None = None
+        if sfg_args.sfg_profile:
+            self._profile = GeneratorProfile(scriptname)
+            self._profile.start()
+        activate_profile(self._profile)
 
-        config = cli_params.get_config()
-        if sfg_config is not None:
-            cli_params.find_conflicts(sfg_config)
-            config.override(sfg_config)
+        with profile_phase("config"):
+            cli_params = CommandLineParameters(sfg_args)
+
+            config = cli_params.get_config()
+            if sfg_config is not None:
+                cli_params.find_conflicts(sfg_config)
+                config.override(sfg_config)
 
         self._header_only: bool = config.get_option("header_only")
         self._output_dir: Path = config.get_option("output_directory")
@@ -89,6 +98,8 @@ class SourceFileGenerator:
         )
         self._impl_file: SfgSourceFile | None
 
+        self._impl_shard_names: list[str] = [f.name for f in output_files[2:]]
+
         if self._header_only:
             self._impl_file = None
         else:
@@ -100,6 +111,12 @@ class SourceFileGenerator:
         #   TODO: Find a way to not hard-code the restrict qualifier in pystencils
         self._header_file.elements.append("#define RESTRICT __restrict__")
 
+        #   The kernel profiling registry, if any, is inserted here at the end of code generation
+        self._profiling_registry_pos = len(self._header_file.elements)
+        self._profiling_enabled: bool = config.profiling.get_option("enable")
+        self._profiling_gpu_ranges: bool = config.profiling.get_option("gpu_ranges")
+        self._basename = basename
+
         outer_namespace: str | _GlobalNamespace = config.get_option("outer_namespace")
 
         namespace: str | None
@@ -108,6 +125,11 @@ class SourceFileGenerator:
         else:
             namespace = outer_namespace
 
+        kernel_cache_dir: Path | None = config.get_option("kernel_cache")
+        kernel_cache = (
+            KernelCache(kernel_cache_dir) if kernel_cache_dir is not None else None
+        )
+
         self._context = SfgContext(
             self._header_file,
             self._impl_file,
@@ -116,6 +138,7 @@ class SourceFileGenerator:
             config.clang_format,
             argv=script_args,
             project_info=cli_params.get_project_info(),
+            kernel_cache=kernel_cache,
         )
 
         sort_key = config.codestyle.get_option("includes_sorting_key")
@@ -129,26 +152,55 @@ class SourceFileGenerator:
         self._include_sort_key: Callable[[HeaderFile], Any] = sort_key
 
     def clean_files(self):
+        """Remove the output files of this generator, if they exist."""
         header_path = self._output_dir / self._header_file.name
         if header_path.exists():
             header_path.unlink()
 
         if self._impl_file is not None:
-            impl_path = self._output_dir / self._impl_file.name
-            if impl_path.exists():
-                impl_path.unlink()
+            for name in [self._impl_file.name] + self._impl_shard_names:
+                impl_path = self._output_dir / name
+                if impl_path.exists():
+                    impl_path.unlink()
+
+    def _instrument_kernel_calls(self) -> None:
+        from re import sub
+        from .ir.profiling import instrument_kernel_calls
+
+        files = [self._header_file]
+        if self._impl_file is not None:
+            files.append(self._impl_file)
+
+        ident = sub(r"\W", "_", self._basename)
+        if ident[0].isdigit():
+            ident = "_" + ident
+
+        instr = instrument_kernel_calls(
+            files, f"sfg_profiling::{ident}", self._profiling_gpu_ranges
+        )
+
+        if instr.kernel_names:
+            self._header_file.elements.insert(
+                self._profiling_registry_pos, instr.registry_code()
+            )
+            self._header_file.includes += instr.registry_includes()
 
     def _finish_files(self) -> None:
         from .ir import collect_includes
 
-        header_includes = collect_includes(self._header_file)
+        if self._profiling_enabled:
+            self._instrument_kernel_calls()
+
+        with profile_phase("collect_includes", self._header_file.name):
+            header_includes = collect_includes(self._header_file)
         self._header_file.includes = list(
             set(self._header_file.includes) | header_includes
         )
         self._header_file.includes.sort(key=self._include_sort_key)
 
         if self._impl_file is not None:
-            impl_includes = collect_includes(self._impl_file)
+            with profile_phase("collect_includes", self._impl_file.name):
+                impl_includes = collect_includes(self._impl_file)
             #   If some header is already included by the generated header file, do not duplicate that inclusion
             impl_includes -= header_includes
             self._impl_file.includes = list(
@@ -164,14 +216,41 @@ class SourceFileGenerator:
         )
 
     def __enter__(self) -> SfgComposer:
-        self.clean_files()
+        #   Existing output files are not removed here;
+        #   the emitter only overwrites them if their content changes.
         return SfgComposer(self._context)
 
     def __exit__(self, exc_type, exc_value, traceback):
-        if exc_type is None:
-            self._finish_files()
-
-            emitter = self._get_emitter()
-            emitter.emit(self._header_file)
-            if self._impl_file is not None:
-                emitter.emit(self._impl_file)
+        try:
+            if exc_type is None:
+                self._finish_files()
+                self._emit_files()
+
+                if self._profile is not None:
+                    self._profile.stop()
+                    self._profile.write(
+                        self._output_dir / f"{self._basename}.sfg-profile.json"
+                    )
+            else:
+                #   Do not leave outdated files behind if code generation failed
+                self.clean_files()
+        finally:
+            activate_profile(None)
+
+    def _emit_files(self) -> None:
+        emitter = self._get_emitter()
+        files = [self._header_file]
+        if self._impl_file is not None:
+            if self._impl_shard_names:
+                from .ir import shard_source_file
+
+                files += shard_source_file(
+                    self._impl_file,
+                    [self._impl_file.name] + self._impl_shard_names,
+                    weight=emitter.estimate_size,
+                )
+            else:
+                files.append(self._impl_file)
+
+        #   Format all output files at once, to save on clang-format invocations
+        emitter.emit_all(files)
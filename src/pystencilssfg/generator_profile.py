@@ -0,0 +1,181 @@
+from __future__ import annotations
+
+from typing import Any, Iterator, Sequence
+from contextlib import contextmanager
+from dataclasses import dataclass, field
+from pathlib import Path
+
+import json
+import time
+import tracemalloc
+
+
+@dataclass
+class _PhaseFrame:
+    name: str
+    label: str | None
+    start: float
+    peak: int = 0
+    children_seconds: float = 0.0
+
+
+@dataclass
+class GeneratorProfile:
+    """Records the wall time and peak memory usage of the phases of a generator script run.
+
+    Memory usage is measured using `tracemalloc`, and therefore only covers allocations
+    made through the Python memory allocator.
+    A phase's peak memory is the highest amount of traced memory observed while the phase was running,
+    including its nested phases.
+
+    Args:
+        script: Name of the profiled generator script
+    """
+
+    script: str
+    phases: list[dict[str, Any]] = field(default_factory=list)
+
+    def __post_init__(self):
+        self._stack: list[_PhaseFrame] = []
+        self._owns_tracing = False
+        self._start: float | None = None
+        self._seconds: float | None = None
+        self._peak = 0
+
+    def start(self):
+        """Start profiling the generator run."""
+        if not tracemalloc.is_tracing():
+            tracemalloc.start()
+            self._owns_tracing = True
+        tracemalloc.reset_peak()
+        self._start = time.perf_counter()
+
+    def stop(self):
+        """Stop profiling the generator run."""
+        assert self._start is not None, "Profile was not started"
+        self._seconds = time.perf_counter() - self._start
+        self._peak = max(
+            [self._peak, tracemalloc.get_traced_memory()[1]]
+            + [p["peak_memory_bytes"] for p in self.phases]
+        )
+        if self._owns_tracing:
+            tracemalloc.stop()
+            self._owns_tracing = False
+
+    @contextmanager
+    def phase(self, name: str, label: str | None = None) -> Iterator[None]:
+        """Record the code executed inside the managed region as a phase called ``name``.
+
+        Args:
+            name: Name of the phase, e.g. ``kernels.create``
+            label: Further identification of the phase's subject, e.g. a kernel or file name
+        """
+        peak_before = tracemalloc.get_traced_memory()[1]
+        if self._stack:
+            parent = self._stack[-1]
+            parent.peak = max(parent.peak, peak_before)
+        else:
+            self._peak = max(self._peak, peak_before)
+
+        tracemalloc.reset_peak()
+        frame = _PhaseFrame(name, label, time.perf_counter())
+        self._stack.append(frame)
+        try:
+            yield
+        finally:
+            seconds = time.perf_counter() - frame.start
+            peak = max(frame.peak, tracemalloc.get_traced_memory()[1])
+            self._stack.pop()
+
+            if self._stack:
+                self._stack[-1].peak = max(self._stack[-1].peak, peak)
+                self._stack[-1].children_seconds += seconds
+
+            self.phases.append(
+                {
+                    "phase": name,
+                    "label": label,
+                    "seconds": seconds,
+                    "self_seconds": seconds - frame.children_seconds,
+                    "peak_memory_bytes": peak,
+                }
+            )
+
+    def report(self) -> dict[str, Any]:
+        """The profiling report, as a JSON-serializable dictionary."""
+        return {
+            "script": self.script,
+            "total": {
+                "seconds": self._seconds,
+                "peak_memory_bytes": self._peak,
+            },
+            "summary": _summarize(self.phases),
+            "phases": self.phases,
+        }
+
+    def write(self, path: Path):
+        """Write the profiling report to the given JSON file."""
+        path.parent.mkdir(parents=True, exist_ok=True)
+        path.write_text(json.dumps(self.report(), indent=2))
+
+
+def _summarize(phases: Sequence[dict[str, Any]]) -> dict[str, dict[str, Any]]:
+    summary: dict[str, dict[str, Any]] = dict()
+    for p in phases:
+        entry = summary.setdefault(
+            p["phase"],
+            {"count": 0, "seconds": 0.0, "self_seconds": 0.0, "peak_memory_bytes": 0},
+        )
+        entry["count"] += p.get("count", 1)
+        entry["seconds"] += p["seconds"]
+        entry["self_seconds"] += p["self_seconds"]
+        entry["peak_memory_bytes"] = max(
+            entry["peak_memory_bytes"], p["peak_memory_bytes"]
+        )
+    return dict(sorted(summary.items(), key=lambda kv: -kv[1]["self_seconds"]))
+
+
+def aggregate_reports(reports: Sequence[dict[str, Any]]) -> dict[str, Any]:
+    """Combine the profiling reports of several generator scripts.
+
+    The aggregated report lists the total time and peak memory of each script,
+    as well as the accumulated time of each phase across all scripts.
+    """
+    scripts = sorted(
+        ({"script": r["script"], **r["total"]} for r in reports),
+        key=lambda s: -(s["seconds"] or 0.0),
+    )
+    phases = [
+        {"phase": name, **entry}
+        for r in reports
+        for name, entry in r["summary"].items()
+    ]
+    return {
+        "total": {
+            "seconds": sum(s["seconds"] or 0.0 for s in scripts),
+            "peak_memory_bytes": max(
+                (s["peak_memory_bytes"] for s in scripts), default=0
+            ),
+        },
+        "summary": _summarize(phases),
+        "scripts": scripts,
+    }
+
+
+_active_profile: GeneratorProfile | None = None
+
+
+def activate_profile(profile: GeneratorProfile | None):
+    """Set the profile into which subsequent phases are recorded; pass `None` to disable profiling."""
+    global _active_profile
+    _active_profile = profile
+
+
+@contextmanager
+def profile_phase(name: str, label: str | None = None) -> Iterator[None]:
+    """Record the managed region as a phase of the active generator profile, if there is any."""
+    if _active_profile is None:
+        yield
+    else:
+        with _active_profile.phase(name, label):
+            yield
@@ -41,6 +41,7 @@ from .syntax import (
 )
 
 from .analysis import collect_includes
+from .sharding import shard_source_file
 
 __all__ = [
     "SfgCallTreeNode",
@@ -77,4 +78,5 @@ __all__ = [
     "SfgSourceFileType",
     "SfgSourceFile",
     "collect_includes",
+    "shard_source_file",
 ]
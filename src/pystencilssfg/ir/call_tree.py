@@ -3,8 +3,11 @@ from typing import TYPE_CHECKING, Sequence, Iterable, NewType
 
 from abc import ABC, abstractmethod
 
+from pystencils.types import deconstify
+
 from .entities import SfgKernelHandle
 from ..lang import SfgVar, HeaderFile
+from ..exceptions import SfgException
 
 if TYPE_CHECKING:
     from ..config import CodeStyle
@@ -50,6 +53,7 @@ class SfgCallTreeLeaf(SfgCallTreeNode, ABC):
     """A leaf node of the call tree.
 
     Leaf nodes must implement ``depends`` for automatic parameter collection.
+    Leaves that introduce new variables must also report them via ``defines``.
     """
 
     def __init__(self):
@@ -59,6 +63,11 @@ class SfgCallTreeLeaf(SfgCallTreeNode, ABC):
     def children(self) -> Sequence[SfgCallTreeNode]:
         return ()
 
+    @property
+    def defines(self) -> set[SfgVar]:
+        """Set of variables newly defined by this leaf"""
+        return set()
+
 
 class SfgEmptyNode(SfgCallTreeLeaf):
     """A leaf node that does not emit any code.
@@ -193,19 +202,61 @@ class SfgBlock(SfgCallTreeNode):
 #         return cast(SfgStatements)
 
 
+def _call_parameters(
+    kernel_handle: SfgKernelHandle, args_from: SfgKernelHandle | None
+) -> str:
+    if args_from is None:
+        return ", ".join(p.name for p in kernel_handle.parameters)
+
+    args = {p.name: p for p in args_from.parameters}
+    call_args = []
+    for p in kernel_handle.parameters:
+        arg = args.get(p.name)
+        if arg is None:
+            raise SfgException(
+                f"Kernel {args_from.name} has no parameter {p.name} "
+                f"to pass on to kernel {kernel_handle.name}"
+            )
+        if arg.dtype == p.dtype:
+            call_args.append(arg.name)
+        else:
+            call_args.append(f"{deconstify(p.dtype).c_string()}( {arg.name} )")
+    return ", ".join(call_args)
+
+
 class SfgKernelCallNode(SfgCallTreeLeaf):
-    def __init__(self, kernel_handle: SfgKernelHandle):
+    """Call to a host kernel.
+
+    Args:
+        kernel_handle: The kernel to call
+        args_from: If given, pass the identically named parameters of this kernel as arguments,
+            converted to the parameter types of ``kernel_handle``
+    """
+
+    def __init__(
+        self,
+        kernel_handle: SfgKernelHandle,
+        args_from: SfgKernelHandle | None = None,
+    ):
         super().__init__()
         self._kernel_handle = kernel_handle
+        self._args_from = args_from
+        self._depends: set[SfgVar] | None = None
+
+    @property
+    def kernel_handle(self) -> SfgKernelHandle:
+        return self._kernel_handle
 
     @property
     def depends(self) -> set[SfgVar]:
-        return set(self._kernel_handle.parameters)
+        if self._depends is None:
+            args_source = self._args_from or self._kernel_handle
+            self._depends = set(args_source.parameters)
+        return self._depends
 
     def get_code(self, cstyle: CodeStyle) -> str:
-        kparams = self._kernel_handle.parameters
         fnc_name = self._kernel_handle.fqname
-        call_parameters = ", ".join([p.name for p in kparams])
+        call_parameters = _call_parameters(self._kernel_handle, self._args_from)
 
         return f"{fnc_name}({call_parameters});"
 
@@ -225,6 +276,7 @@ class SfgGpuKernelInvocation(SfgCallTreeNode):
         block_size: SfgStatements,
         shared_memory_bytes: SfgStatements | None,
         stream: SfgStatements | None,
+        args_from: SfgKernelHandle | None = None,
     ):
         from pystencils.codegen import GpuKernel
 
@@ -240,6 +292,17 @@ class SfgGpuKernelInvocation(SfgCallTreeNode):
         self._block_size = block_size
         self._shared_memory_bytes = shared_memory_bytes
         self._stream = stream
+        self._args_from = args_from
+        self._depends: set[SfgVar] | None = None
+
+    @property
+    def kernel_handle(self) -> SfgKernelHandle:
+        return self._kernel_handle
+
+    @property
+    def stream(self) -> SfgStatements | None:
+        """The stream the kernel is launched on, if given"""
+        return self._stream
 
     @property
     def children(self) -> Sequence[SfgCallTreeNode]:
@@ -258,12 +321,14 @@ class SfgGpuKernelInvocation(SfgCallTreeNode):
 
     @property
     def depends(self) -> set[SfgVar]:
-        return set(self._kernel_handle.parameters)
+        if self._depends is None:
+            args_source = self._args_from or self._kernel_handle
+            self._depends = set(args_source.parameters)
+        return self._depends
 
     def get_code(self, cstyle: CodeStyle) -> str:
-        kparams = self._kernel_handle.parameters
         fnc_name = self._kernel_handle.fqname
-        call_parameters = ", ".join([p.name for p in kparams])
+        call_parameters = _call_parameters(self._kernel_handle, self._args_from)
 
         grid_args = [self._grid_size, self._block_size]
         if self._shared_memory_bytes is not None:
@@ -10,8 +10,8 @@ from typing import (
 )
 from itertools import chain
 
-from pystencils import Field
-from pystencils.codegen import Kernel
+from pystencils import Field, AssignmentCollection
+from pystencils.codegen import Kernel, CreateKernelConfig
 from pystencils.types import PsType, PsCustomType
 
 from ..lang import SfgVar, SfgKernelParamVar, void, ExprLike
@@ -155,6 +155,15 @@ class SfgKernelHandle(SfgCodeEntity):
 
         self._inline: bool = inline
 
+        self._contiguous_variant: SfgKernelHandle | None = None
+        self._contiguity_strides: tuple[SfgKernelParamVar, ...] = ()
+        self._assignments: AssignmentCollection | None = None
+        self._config: CreateKernelConfig | None = None
+        self._int32_variant: SfgKernelHandle | None = None
+        self._static_shape_variants: list[
+            tuple[SfgKernelHandle, tuple[tuple[SfgKernelParamVar, int], ...]]
+        ] = []
+
         self._scalar_params: set[SfgVar] = set()
         self._fields: set[Field] = set()
 
@@ -188,6 +197,96 @@ class SfgKernelHandle(SfgCodeEntity):
     def inline(self) -> bool:
         return self._inline
 
+    @property
+    def contiguous_variant(self) -> SfgKernelHandle | None:
+        """Variant of this kernel specialized for contiguous memory layouts, if one exists.
+
+        The contiguous variant may be called instead of this kernel
+        if all parameters listed in `contiguity_strides` are equal to one.
+        """
+        return self._contiguous_variant
+
+    @property
+    def contiguity_strides(self) -> tuple[SfgKernelParamVar, ...]:
+        """Stride parameters of this kernel that are fixed to one in its `contiguous_variant`."""
+        return self._contiguity_strides
+
+    @property
+    def int32_variant(self) -> SfgKernelHandle | None:
+        """Variant of this kernel using 32-bit index arithmetic, if one exists.
+
+        The variant may be called instead of this kernel if the extents and strides of all
+        fields are small enough for each memory offset to be representable in 32 bits.
+        Its parameters have the same names as this kernel's parameters.
+        """
+        return self._int32_variant
+
+    def set_int32_variant(self, variant: SfgKernelHandle):
+        """Register a variant of this kernel using 32-bit index arithmetic."""
+        self._int32_variant = variant
+
+    @property
+    def static_shape_variants(
+        self,
+    ) -> tuple[tuple[SfgKernelHandle, tuple[tuple[SfgKernelParamVar, int], ...]], ...]:
+        """Variants of this kernel specialized for fixed field extents.
+
+        Each entry is a pair of the specialized kernel and the list of ``(parameter, extent)``
+        pairs of this kernel's shape parameters that are fixed in the specialization.
+        A specialization may be called instead of this kernel if each listed shape parameter
+        is equal to its respective extent.
+        """
+        return tuple(self._static_shape_variants)
+
+    def add_static_shape_variant(
+        self,
+        variant: SfgKernelHandle,
+        shape_params: Sequence[tuple[SfgKernelParamVar, int]],
+    ):
+        """Register a variant of this kernel specialized for fixed field extents.
+
+        Args:
+            variant: The specialized kernel
+            shape_params: Shape parameters of this kernel that are fixed in the specialized kernel,
+                together with their fixed values
+        """
+        self._static_shape_variants.append((variant, tuple(shape_params)))
+
+    @property
+    def assignments(self) -> AssignmentCollection | None:
+        """The assignments this kernel was generated from, if known.
+
+        Only available for kernels created through `KernelsAdder.create`."""
+        return self._assignments
+
+    @property
+    def config(self) -> CreateKernelConfig | None:
+        """The code generator configuration this kernel was generated with, if known.
+
+        Only available for kernels created through `KernelsAdder.create`."""
+        return self._config
+
+    def set_assignments(
+        self,
+        assignments: AssignmentCollection,
+        config: CreateKernelConfig | None = None,
+    ):
+        """Record the assignments and configuration this kernel was generated from."""
+        self._assignments = assignments
+        self._config = config
+
+    def set_contiguous_variant(
+        self, variant: SfgKernelHandle, strides: Sequence[SfgKernelParamVar]
+    ):
+        """Register a variant of this kernel specialized for contiguous memory layouts.
+
+        Args:
+            variant: The specialized kernel
+            strides: Stride parameters of this kernel that are fixed to one in the specialized kernel
+        """
+        self._contiguous_variant = variant
+        self._contiguity_strides = tuple(strides)
+
 
 class SfgKernelNamespace(SfgNamespace):
     """A namespace grouping together a number of kernels."""
@@ -226,11 +325,24 @@ class CommonFunctionProperties:
     attributes: Sequence[str]
 
     @staticmethod
-    def collect_params(tree: SfgCallTreeNode, required_params: Sequence[SfgVar] | None):
+    def collect_params(
+        tree: SfgCallTreeNode,
+        required_params: Sequence[SfgVar] | None,
+        bound_vars: Sequence[SfgVar] = (),
+    ):
+        """Collect the free variables of the given function body.
+
+        Free variables contained in ``bound_vars``
+        (e.g. variables stored in members of the owning class) are not considered parameters.
+        """
         from .postprocessing import CallTreePostProcessing
+        from ..generator_profile import profile_phase
 
         param_collector = CallTreePostProcessing()
-        params_set = param_collector(tree).function_params
+        with profile_phase("postprocessing"):
+            free_vars = param_collector(tree).function_params
+        bound_set = set(bound_vars)
+        params_set = set(p for p in free_vars if p not in bound_set)
 
         if required_params is not None:
             if not (params_set <= set(required_params)):
@@ -371,6 +483,7 @@ class SfgMethod(SfgClassMember, CommonFunctionProperties):
         override: bool = False,
         attributes: Sequence[str] = (),
         required_params: Sequence[SfgVar] | None = None,
+        bound_vars: Sequence[SfgVar] = (),
     ):
         super().__init__(cls)
 
@@ -380,7 +493,7 @@ class SfgMethod(SfgClassMember, CommonFunctionProperties):
         self._virtual = virtual
         self._override = override
 
-        parameters = self.collect_params(tree, required_params)
+        parameters = self.collect_params(tree, required_params, bound_vars)
 
         CommonFunctionProperties.__init__(
             self,
@@ -1,7 +1,8 @@
 from __future__ import annotations
-from typing import Sequence, Iterable
+from typing import Callable, Sequence, Iterable
 import warnings
 from dataclasses import dataclass
+from functools import partial
 
 from abc import ABC, abstractmethod
 
@@ -14,16 +15,23 @@ from pystencils.codegen.properties import FieldBasePtr, FieldShape, FieldStride
 from ..exceptions import SfgException
 from ..config import CodeStyle
 
-from .call_tree import SfgCallTreeNode, SfgSequence, SfgStatements
+from .call_tree import (
+    SfgCallTreeNode,
+    SfgCallTreeLeaf,
+    SfgSequence,
+    SfgStatements,
+)
 from ..lang.expressions import SfgKernelParamVar
 from ..lang import (
     SfgVar,
+    HeaderFile,
     SupportsFieldExtraction,
     SupportsVectorExtraction,
     ExprLike,
     AugExpr,
     depends,
     includes,
+    assume_aligned,
 )
 
 
@@ -31,6 +39,9 @@ class PostProcessingContext:
     def __init__(self) -> None:
         self._live_variables: dict[str, SfgVar] = dict()
 
+        #   Index of the live field-associated kernel parameters, by field and variable name
+        self._live_field_params: dict[Field, dict[str, SfgKernelParamVar]] = dict()
+
     @property
     def live_variables(self) -> set[SfgVar]:
         return set(self._live_variables.values())
@@ -38,7 +49,31 @@ class PostProcessingContext:
     def get_live_variable(self, name: str) -> SfgVar | None:
         return self._live_variables.get(name)
 
-    def _define(self, vars: Iterable[SfgVar], expr: str):
+    def get_live_field_params(self, field: Field) -> Iterable[SfgKernelParamVar]:
+        """Live kernel parameters holding the base pointer, shape, or strides of the given field"""
+        return self._live_field_params.get(field, dict()).values()
+
+    @staticmethod
+    def _fields_of(var: SfgVar) -> set[Field]:
+        fields: set[Field] = set()
+        if isinstance(var, SfgKernelParamVar):
+            for prop in var.wrapped.properties:
+                match prop:
+                    case FieldBasePtr(field) | FieldShape(field, _) | FieldStride(field, _):  # type: ignore
+                        fields.add(field)
+        return fields
+
+    def _set_live(self, var: SfgVar):
+        self._live_variables[var.name] = var
+        for field in self._fields_of(var):
+            self._live_field_params.setdefault(field, dict())[var.name] = var  # type: ignore
+
+    def _kill(self, var: SfgVar):
+        del self._live_variables[var.name]
+        for field in self._fields_of(var):
+            self._live_field_params[field].pop(var.name, None)
+
+    def _define(self, vars: Iterable[SfgVar], expr: str | Callable[[], str]):
         for var in vars:
             if var.name in self._live_variables:
                 live_var = self._live_variables[var.name]
@@ -51,13 +86,15 @@ class PostProcessingContext:
                 if (def_dtype.const and not live_var_dtype.const) or (
                     deconstify(def_dtype) != deconstify(live_var_dtype)
                 ):
+                    #   The definition's code is only rendered when needed for the warning
+                    expr_code = expr if isinstance(expr, str) else expr()
                     warnings.warn(
                         f"Type conflict at variable definition: Expected type {live_var_dtype}, but got {def_dtype}.\n"
-                        f"    * At definition {expr}",
+                        f"    * At definition {expr_code}",
                         UserWarning,
                     )
 
-                del self._live_variables[var.name]
+                self._kill(live_var)
 
     def _use(self, vars: Iterable[SfgVar]):
         for var in vars:
@@ -79,7 +116,8 @@ class PostProcessingContext:
                         #   Same type, just different constness
                         #   One of them must be non-const -> keep the non-const one
                         if live_var.dtype.const and not var.dtype.const:
-                            self._live_variables[var.name] = var
+                            self._kill(live_var)
+                            self._set_live(var)
                     else:
                         raise SfgException(
                             "Encountered two variables with same name but different data types:\n"
@@ -88,7 +126,7 @@ class PostProcessingContext:
                             f"    {live_var.name_and_type()}"
                         )
             else:
-                self._live_variables[var.name] = var
+                self._set_live(var)
 
 
 @dataclass(frozen=True)
@@ -115,6 +153,8 @@ class CallTreePostProcessing:
                 else:
                     if isinstance(c, SfgStatements):
                         ppc._define(c.defines, c.code_string)
+                    elif isinstance(c, SfgCallTreeLeaf) and c.defines:
+                        ppc._define(c.defines, partial(c.get_code, CodeStyle()))
 
                     ppc._use(self.get_live_variables(c))
 
@@ -193,10 +233,14 @@ class SfgDeferredFieldMapping(SfgDeferredNode):
         psfield: Field,
         extraction: SupportsFieldExtraction,
         cast_indexing_symbols: bool = True,
+        alignment: int | None = None,
+        check_alignment: bool = False,
     ):
         self._field = psfield
         self._extraction = extraction
         self._cast_indexing_symbols = cast_indexing_symbols
+        self._alignment = alignment
+        self._check_alignment = check_alignment
 
     def expand(self, ppc: PostProcessingContext) -> SfgCallTreeNode:
         #    Find field pointer
@@ -212,16 +256,15 @@ class SfgDeferredFieldMapping(SfgDeferredNode):
         shape: list[SfgKernelParamVar | str | None] = [None] * rank
         strides: list[SfgKernelParamVar | str | None] = [None] * rank
 
-        for param in ppc.live_variables:
-            if isinstance(param, SfgKernelParamVar):
-                for prop in param.wrapped.properties:
-                    match prop:
-                        case FieldBasePtr(field) if field == self._field:
-                            ptr = param
-                        case FieldShape(field, coord) if field == self._field:  # type: ignore
-                            shape[coord] = param  # type: ignore
-                        case FieldStride(field, coord) if field == self._field:  # type: ignore
-                            strides[coord] = param  # type: ignore
+        for param in ppc.get_live_field_params(self._field):
+            for prop in param.wrapped.properties:
+                match prop:
+                    case FieldBasePtr(field) if field == self._field:
+                        ptr = param
+                    case FieldShape(field, coord) if field == self._field:  # type: ignore
+                        shape[coord] = param  # type: ignore
+                    case FieldStride(field, coord) if field == self._field:  # type: ignore
+                        strides[coord] = param  # type: ignore
 
         #   Find constant or otherwise determined sizes
         for coord, s in enumerate(self._field.shape[:rank]):
@@ -238,7 +281,22 @@ class SfgDeferredFieldMapping(SfgDeferredNode):
         done: set[SfgKernelParamVar] = set()
 
         if ptr is not None:
-            expr = self._extraction._extract_ptr()
+            raw_ptr = self._extraction._extract_ptr()
+
+            if self._alignment is not None and self._check_alignment:
+                #   Check the raw pointer, since the compiler may assume
+                #   the alignment of the pointer returned by `std::assume_aligned` to hold
+                nodes.append(
+                    SfgStatements(
+                        f"assert( reinterpret_cast< std::uintptr_t >( {raw_ptr} ) % {self._alignment} == 0 );",
+                        (),
+                        depends(raw_ptr),
+                        (HeaderFile.parse("<cassert>"), HeaderFile.parse("<cstdint>"))
+                        + tuple(includes(raw_ptr)),
+                    )
+                )
+
+            expr = assume_aligned(raw_ptr, self._alignment)
             nodes.append(
                 SfgStatements(
                     f"{ptr.dtype.c_string()} {ptr.name} {{ {expr} }};",
@@ -314,9 +372,9 @@ class SfgDeferredVectorMapping(SfgDeferredNode):
     def expand(self, ppc: PostProcessingContext) -> SfgCallTreeNode:
         nodes = []
 
-        for param in ppc.live_variables:
-            if param.name in self._scalars:
-                idx, _ = self._scalars[param.name]
+        for name, (idx, _) in self._scalars.items():
+            param = ppc.get_live_variable(name)
+            if param is not None:
                 expr = self._vector._extract_component(idx)
                 nodes.append(
                     SfgStatements(
@@ -0,0 +1,249 @@
+from __future__ import annotations
+
+from typing import Sequence
+
+from pystencils.codegen import Target
+
+from ..lang import HeaderFile
+from .call_tree import (
+    SfgCallTreeNode,
+    SfgKernelCallNode,
+    SfgGpuKernelInvocation,
+    SfgSequence,
+    SfgBlock,
+    SfgStatements,
+)
+from .entities import SfgFunction, SfgMethod
+from .syntax import (
+    SfgSourceFile,
+    SfgNamespaceElement,
+    SfgClassBodyElement,
+    SfgNamespaceBlock,
+    SfgEntityDef,
+    SfgClassBody,
+    SfgVisibilityBlock,
+)
+
+
+class SfgUnprofiledSequence(SfgSequence):
+    """A sequence whose kernel calls are exempt from profiling instrumentation.
+
+    Used for code regions in which timing instrumentation is not permitted,
+    such as the body of a GPU graph capture.
+    """
+
+
+class KernelProfilingInstrumentation:
+    """Wraps kernel calls in the function bodies of source files in timing instrumentation.
+
+    Each distinct kernel is assigned a slot in a profiling registry,
+    which records the number of calls to the kernel and their accumulated run time in nanoseconds.
+    Host kernel calls are timed using ``std::chrono::steady_clock``.
+    GPU kernel invocations are timed using a pair of CUDA or HIP events recorded on the kernel's stream;
+    the instrumentation waits for the kernel to complete, and therefore serializes the invocations.
+
+    Args:
+        registry_namespace: Fully qualified name of the namespace hosting the registry
+        gpu_ranges: Whether to additionally enclose each GPU kernel invocation
+            in an NVTX or roctx range named after the kernel
+    """
+
+    def __init__(self, registry_namespace: str, gpu_ranges: bool = False):
+        self._registry_namespace = registry_namespace
+        self._gpu_ranges = gpu_ranges
+        self._kernel_slots: dict[str, int] = dict()
+        self._visited: set[int] = set()
+
+    @property
+    def kernel_names(self) -> tuple[str, ...]:
+        """Fully qualified names of all instrumented kernels, in the order of their registry slots"""
+        return tuple(self._kernel_slots.keys())
+
+    def instrument(self, file: SfgSourceFile):
+        """Instrument all kernel calls inside the function and method definitions of ``file``."""
+
+        def walk_syntax(
+            obj: SfgNamespaceElement | SfgClassBodyElement | SfgVisibilityBlock,
+        ):
+            match obj:
+                case SfgEntityDef(SfgFunction() | SfgMethod() as entity):
+                    if id(entity) not in self._visited:
+                        self._visited.add(id(entity))
+                        self._walk_tree(entity.tree)
+                case SfgNamespaceBlock(_, elements) | SfgVisibilityBlock(_, elements):
+                    for elem in elements:
+                        walk_syntax(elem)
+                case SfgClassBody(_, vblocks):
+                    for vb in vblocks:
+                        walk_syntax(vb)
+
+        for elem in file.elements:
+            walk_syntax(elem)
+
+    def registry_code(self) -> str:
+        """Code of the profiling registry.
+
+        The registry must be placed before any instrumented code in the generated header file."""
+        profiles = ",\n".join(
+            f'  {{ "{name}", 0, 0 }}' for name in self._kernel_slots.keys()
+        )
+        return (
+            "#ifndef PYSTENCILSSFG_KERNEL_PROFILE_DEFINED\n"
+            "#define PYSTENCILSSFG_KERNEL_PROFILE_DEFINED\n"
+            "namespace sfg_profiling {\n"
+            "/** Profiling record of a generated kernel */\n"
+            "struct KernelProfile {\n"
+            "  const char * name;\n"
+            "  std::atomic< std::uint64_t > calls;\n"
+            "  std::atomic< std::uint64_t > nanoseconds;\n"
+            "};\n"
+            "}\n"
+            "#endif\n\n"
+            f"namespace {self._registry_namespace} {{\n"
+            f"inline std::array< ::sfg_profiling::KernelProfile, {len(self._kernel_slots)} > kernel_profiles {{{{\n"
+            f"{profiles}\n"
+            "}};\n"
+            "}"
+        )
+
+    @staticmethod
+    def registry_includes() -> list[HeaderFile]:
+        """Headers required by the profiling registry"""
+        return [HeaderFile.parse(h) for h in ("<array>", "<atomic>", "<cstdint>")]
+
+    def _walk_tree(self, node: SfgCallTreeNode):
+        if isinstance(node, SfgUnprofiledSequence):
+            return
+
+        if isinstance(node, SfgSequence):
+            for i, c in enumerate(node.children):
+                if isinstance(c, SfgKernelCallNode):
+                    node[i] = self._instrument_host_call(c)
+                elif isinstance(c, SfgGpuKernelInvocation):
+                    node[i] = self._instrument_gpu_invocation(c)
+                else:
+                    self._walk_tree(c)
+        else:
+            for c in node.children:
+                self._walk_tree(c)
+
+    def _record(self, kernel_fqname: str) -> str:
+        slot = self._kernel_slots.setdefault(kernel_fqname, len(self._kernel_slots))
+        return f"::{self._registry_namespace}::kernel_profiles[{slot}]"
+
+    def _update_record(self, kernel_fqname: str, nanoseconds: str) -> SfgStatements:
+        return SfgStatements(
+            f"auto & __sfg_profile = {self._record(kernel_fqname)};\n"
+            "__sfg_profile.calls.fetch_add(1, std::memory_order_relaxed);\n"
+            f"__sfg_profile.nanoseconds.fetch_add({nanoseconds}, std::memory_order_relaxed);",
+            (),
+            (),
+        )
+
+    def _instrument_host_call(self, call: SfgKernelCallNode) -> SfgCallTreeNode:
+        fqname = call.kernel_handle.fqname
+        clock = "std::chrono::steady_clock"
+        return SfgBlock(
+            SfgSequence(
+                [
+                    SfgStatements(
+                        f"const auto __sfg_profile_start = {clock}::now();",
+                        (),
+                        (),
+                        (HeaderFile.parse("<chrono>"),),
+                    ),
+                    call,
+                    self._update_record(
+                        fqname,
+                        "std::uint64_t( std::chrono::duration_cast< std::chrono::nanoseconds >"
+                        f"( {clock}::now() - __sfg_profile_start ).count() )",
+                    ),
+                ]
+            )
+        )
+
+    def _instrument_gpu_invocation(
+        self, invocation: SfgGpuKernelInvocation
+    ) -> SfgCallTreeNode:
+        from ..lang import AugExpr, includes
+        from ..lang.gpu import CudaAPI, HipAPI, ProvidesGpuRuntimeAPI
+
+        khandle = invocation.kernel_handle
+        fqname = khandle.fqname
+
+        api: type[ProvidesGpuRuntimeAPI]
+        match khandle.kernel.target:
+            case Target.CUDA:
+                api, tracer = CudaAPI, ("nvtx", "<nvtx3/nvToolsExt.h>")
+            case Target.HIP:
+                api, tracer = HipAPI, ("roctx", "<roctracer/roctx.h>")
+            case _:
+                assert False, "unexpected GPU target"
+
+        stream = (
+            invocation.stream.code_string if invocation.stream is not None else "0"
+        )
+        start = api.event_t().var("__sfg_profile_start")
+        stop = api.event_t().var("__sfg_profile_stop")
+
+        def stmts(*exprs: AugExpr | str) -> SfgStatements:
+            return SfgStatements(
+                "\n".join(f"{e};" for e in exprs),
+                (),
+                (),
+                set().union(*(includes(e) for e in exprs)),
+            )
+
+        before: list[SfgCallTreeNode] = [
+            stmts(
+                f"{start.get_dtype().c_string()} {start}, {stop}",
+                api.event_create(start),
+                api.event_create(stop),
+                api.event_record(start, stream),
+            )
+        ]
+
+        after: list[SfgCallTreeNode] = [
+            stmts(
+                api.event_record(stop, stream),
+                api.event_synchronize(stop),
+                "float __sfg_profile_ms { 0.0f }",
+                api.event_elapsed_time("__sfg_profile_ms", start, stop),
+                api.event_destroy(start),
+                api.event_destroy(stop),
+            ),
+            self._update_record(
+                fqname, "std::uint64_t( double(__sfg_profile_ms) * 1.0e6 )"
+            ),
+        ]
+
+        if self._gpu_ranges:
+            name, header = tracer
+            before.insert(
+                0,
+                SfgStatements(
+                    f'{name}RangePushA("{fqname}");',
+                    (),
+                    (),
+                    (HeaderFile.parse(header),),
+                ),
+            )
+            after.insert(1, SfgStatements(f"{name}RangePop();", (), ()))
+
+        return SfgBlock(SfgSequence(before + [invocation] + after))
+
+
+def instrument_kernel_calls(
+    files: Sequence[SfgSourceFile],
+    registry_namespace: str,
+    gpu_ranges: bool = False,
+) -> KernelProfilingInstrumentation:
+    """Instrument all kernel calls in the given files for profiling.
+
+    Returns:
+        The instrumentation object, from which the registry code can be obtained.
+    """
+    instr = KernelProfilingInstrumentation(registry_namespace, gpu_ranges)
+    for file in files:
+        instr.instrument(file)
+    return instr
@@ -0,0 +1,94 @@
+from __future__ import annotations
+
+from typing import Callable, Sequence
+
+from .entities import SfgKernelHandle
+from .syntax import (
+    SfgSourceFile,
+    SfgNamespaceElement,
+    SfgNamespaceBlock,
+    SfgEntityDecl,
+    SfgEntityDef,
+)
+
+
+def shard_source_file(
+    file: SfgSourceFile,
+    shard_names: Sequence[str],
+    weight: Callable[[SfgEntityDef], int] = lambda _: 1,
+) -> list[SfgSourceFile]:
+    """Distribute the definitions of an implementation file across several files.
+
+    Each entity definition in ``file`` is assigned to exactly one of the shards,
+    such that the total weight of the definitions is spread as evenly as possible.
+    All other elements (e.g. verbatim code) are placed in the first shard only,
+    since they may contain definitions that must not be duplicated;
+    definitions in the other shards must therefore not depend on them.
+    The namespace structure of the original file is preserved.
+    Kernels defined in one shard are declared in all other shards,
+    such that functions calling them may be placed anywhere.
+    Declarations of all other entities must be provided by a header included by every shard.
+
+    Args:
+        file: The implementation file to split up
+        shard_names: File names of the shards
+        weight: Function estimating the compilation cost of a definition
+
+    Returns:
+        The list of shards, in the order of ``shard_names``.
+        The shards have the same file type, prelude, and includes as ``file``.
+    """
+    num_shards = len(shard_names)
+    if num_shards < 1:
+        raise ValueError("At least one shard name must be given.")
+
+    definitions: list[SfgEntityDef] = []
+
+    def collect(elements: Sequence[SfgNamespaceElement]):
+        for elem in elements:
+            match elem:
+                case SfgNamespaceBlock(_, children, _):
+                    collect(children)
+                case SfgEntityDef():
+                    definitions.append(elem)
+
+    collect(file.elements)
+
+    #   Greedily assign the heaviest definitions first to the least-loaded shard
+    weights = {id(d): weight(d) for d in definitions}
+    loads = [0] * num_shards
+    assignment: dict[int, int] = dict()
+    for defin in sorted(definitions, key=lambda d: weights[id(d)], reverse=True):
+        target = min(range(num_shards), key=lambda i: loads[i])
+        assignment[id(defin)] = target
+        loads[target] += weights[id(defin)]
+
+    def filter_elements(
+        elements: Sequence[SfgNamespaceElement], shard: int
+    ) -> list[SfgNamespaceElement]:
+        result: list[SfgNamespaceElement] = []
+        for elem in elements:
+            match elem:
+                case SfgNamespaceBlock(namespace, children, label):
+                    block = SfgNamespaceBlock(namespace, label)
+                    block.elements = filter_elements(children, shard)
+                    if block.elements:
+                        result.append(block)
+                case SfgEntityDef(entity):
+                    if assignment[id(elem)] == shard:
+                        result.append(elem)
+                    elif isinstance(entity, SfgKernelHandle):
+                        result.append(SfgEntityDecl(entity))
+                case _:
+                    if shard == 0:
+                        result.append(elem)
+        return result
+
+    shards: list[SfgSourceFile] = []
+    for i, name in enumerate(shard_names):
+        shard = SfgSourceFile(name, file.file_type, file.prelude)
+        shard.includes = file.includes
+        shard.elements = filter_elements(file.elements, i)
+        shards.append(shard)
+
+    return shards
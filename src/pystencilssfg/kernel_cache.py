@@ -0,0 +1,219 @@
+from __future__ import annotations
+
+from typing import Any, Sequence
+from dataclasses import is_dataclass, fields
+from enum import Enum
+from pathlib import Path
+from warnings import warn
+
+import hashlib
+import os
+import pickle
+import sys
+import tempfile
+
+import sympy as sp
+
+from pystencils import Field, Assignment, AssignmentCollection, CreateKernelConfig
+from pystencils.codegen import Kernel
+from pystencils.types import PsStructType
+
+
+class _Uncacheable(Exception):
+    """Raised if an object has no stable textual description."""
+
+
+def _describe_dtype(dtype: Any) -> str:
+    #   Struct types print as their name only, so their members must be described explicitly
+    if isinstance(dtype, PsStructType):
+        members = ", ".join(
+            f"{m.name}: {_describe_dtype(m.dtype)}" for m in dtype.members
+        )
+        name = "" if dtype.anonymous else dtype.name
+        return f"struct {name}{{{members}}}"
+    return str(dtype)
+
+
+def _describe(obj: Any) -> str:
+    """Stable textual description of an object, for hashing."""
+    match obj:
+        case None | bool() | int() | float() | str():
+            return repr(obj)
+        case Enum():
+            return f"{type(obj).__qualname__}({obj.value!r})"
+        case Field():
+            return "Field({})".format(
+                ", ".join(
+                    _describe(entry)
+                    for entry in (
+                        obj.name,
+                        obj.field_type,
+                        _describe_dtype(obj.dtype),
+                        obj.layout,
+                        obj.shape,
+                        obj.strides,
+                    )
+                )
+            )
+        case sp.Basic():
+            return sp.srepr(obj)
+        case tuple() | list():
+            return "(" + ", ".join(_describe(item) for item in obj) + ")"
+        case set() | frozenset():
+            return "{" + ", ".join(sorted(_describe(item) for item in obj)) + "}"
+        case dict():
+            return (
+                "{"
+                + ", ".join(
+                    sorted(f"{_describe(k)}: {_describe(v)}" for k, v in obj.items())
+                )
+                + "}"
+            )
+
+    if is_dataclass(obj):
+        entries = [f"{f.name}={_describe(getattr(obj, f.name))}" for f in fields(obj)]
+        return f"{type(obj).__qualname__}({', '.join(entries)})"
+
+    if hasattr(obj, "__dict__") and not callable(obj):
+        entries = [f"{k}={_describe(v)}" for k, v in sorted(vars(obj).items())]
+        return f"{type(obj).__qualname__}({', '.join(entries)})"
+
+    desc = repr(obj)
+    if " at 0x" in desc:
+        #   Default representation containing the object's address; not stable across runs
+        raise _Uncacheable(desc)
+    return desc
+
+
+def _describe_assignments(assignments: Sequence[Assignment]) -> str:
+    lines: list[str] = []
+    atoms: set[str] = set()
+
+    for asm in assignments:
+        lines.append(f"{sp.srepr(asm.lhs)} := {sp.srepr(asm.rhs)}")
+        for expr in (asm.lhs, asm.rhs):
+            for acc in expr.atoms(Field.Access):
+                atoms.add(
+                    f"{acc.name}: {_describe(acc.field)}[{_describe(acc.offsets)}]"
+                    f"({_describe(acc.index)}), absolute={acc.is_absolute_access}"
+                )
+            for symb in expr.atoms(sp.Symbol):
+                atoms.add(
+                    f"{type(symb).__qualname__} {symb.name}: {getattr(symb, 'dtype', None)}"
+                )
+
+    return "\n".join(lines + sorted(atoms))
+
+
+class KernelCache:
+    """Persistent on-disk cache of pystencils kernels.
+
+    Kernels are stored as pickled files in the cache directory,
+    keyed by a hash of their assignments, their code generator configuration,
+    and the versions of Python, pystencils and pystencils-sfg.
+    Kernels whose configuration cannot be described stably (e.g. because it contains
+    callables), or which cannot be pickled, are not cached.
+    The cache directory may be shared by several generator scripts and processes,
+    and can be cleared simply by deleting it.
+
+    Args:
+        directory: Directory holding the cached kernels; it is created if it does not exist
+    """
+
+    def __init__(self, directory: str | Path):
+        self._directory = Path(directory)
+        self._hits = 0
+        self._misses = 0
+
+    @property
+    def directory(self) -> Path:
+        return self._directory
+
+    @property
+    def hits(self) -> int:
+        """Number of kernels loaded from the cache"""
+        return self._hits
+
+    @property
+    def misses(self) -> int:
+        """Number of kernels that had to be created"""
+        return self._misses
+
+    def key(
+        self,
+        assignments: AssignmentCollection,
+        config: CreateKernelConfig,
+    ) -> str | None:
+        """Cache key of the kernel created from the given assignments and configuration,
+        or `None` if it cannot be cached."""
+        import pystencils
+        from . import __version__ as sfg_version
+
+        try:
+            description = "\n".join(
+                [
+                    f"python {sys.version_info.major}.{sys.version_info.minor}",
+                    f"pystencils {pystencils.__version__}",
+                    f"pystencils-sfg {sfg_version}",
+                    _describe(config),
+                    _describe_assignments(assignments.all_assignments),
+                ]
+            )
+        except (_Uncacheable, RecursionError):
+            return None
+
+        return hashlib.sha256(description.encode()).hexdigest()
+
+    def create_kernel(
+        self,
+        assignments: AssignmentCollection,
+        config: CreateKernelConfig,
+    ) -> Kernel:
+        """Load the kernel for the given assignments and configuration from the cache,
+        or create it through `create_kernel <pystencils.codegen.create_kernel>`
+        and store it in the cache."""
+        from pystencils import create_kernel
+
+        key = self.key(assignments, config)
+        if key is None:
+            self._misses += 1
+            return create_kernel(assignments, config=config)
+
+        entry = self._directory / f"{key}.pickle"
+        if entry.exists():
+            try:
+                with entry.open("rb") as f:
+                    kernel = pickle.load(f)
+                if isinstance(kernel, Kernel):
+                    self._hits += 1
+                    return kernel
+            except Exception:
+                #   Corrupt or incompatible entry; recreate the kernel
+                pass
+
+        self._misses += 1
+        kernel = create_kernel(assignments, config=config)
+        self._store(entry, kernel)
+        return kernel
+
+    def _store(self, entry: Path, kernel: Kernel):
+        try:
+            data = pickle.dumps(kernel)
+        except Exception as e:
+            warn(
+                f"Kernel {kernel.name} cannot be stored in the kernel cache: {e}",
+                UserWarning,
+            )
+            return
+
+        self._directory.mkdir(parents=True, exist_ok=True)
+
+        #   Write atomically, such that concurrent generator runs never observe partial entries
+        fd, tmp_path = tempfile.mkstemp(dir=self._directory, suffix=".tmp")
+        try:
+            with os.fdopen(fd, "wb") as f:
+                f.write(data)
+            os.replace(tmp_path, entry)
+        except OSError:
+            if os.path.exists(tmp_path):
+                os.unlink(tmp_path)
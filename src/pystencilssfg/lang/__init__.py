@@ -15,7 +15,11 @@ from .expressions import (
     cppclass,
 )
 
-from .extractions import SupportsFieldExtraction, SupportsVectorExtraction
+from .extractions import (
+    SupportsFieldExtraction,
+    SupportsVectorExtraction,
+    assume_aligned,
+)
 
 from .types import cpptype, void, Ref, strip_ptr_ref
 
@@ -39,4 +43,5 @@ __all__ = [
     "strip_ptr_ref",
     "SupportsFieldExtraction",
     "SupportsVectorExtraction",
+    "assume_aligned",
 ]
@@ -11,7 +11,13 @@ from pystencils.types import (
 
 from pystencilssfg.lang.expressions import AugExpr
 
-from ...lang import SupportsFieldExtraction, cpptype, HeaderFile, ExprLike
+from ...lang import (
+    SupportsFieldExtraction,
+    cpptype,
+    HeaderFile,
+    ExprLike,
+    assume_aligned,
+)
 
 
 class StdMdspan(AugExpr, SupportsFieldExtraction):
@@ -74,6 +80,12 @@ class StdMdspan(AugExpr, SupportsFieldExtraction):
     .. _std::layout_right: https://en.cppreference.com/w/cpp/container/mdspan/layout_right
     .. _std::layout_stride: https://en.cppreference.com/w/cpp/container/mdspan/layout_stride
 
+    **Alignment**
+
+    If the memory viewed by the ``mdspan`` is known to be over-aligned,
+    pass its alignment in bytes as ``alignment``.
+    The extracted data handle will then be marked with ``std::assume_aligned``.
+
     Args:
         T: Element type of the mdspan
     """
@@ -99,6 +111,7 @@ class StdMdspan(AugExpr, SupportsFieldExtraction):
         layout_policy: str | None = None,
         ref: bool = False,
         const: bool = False,
+        alignment: int | None = None,
     ):
         T = create_type(T)
 
@@ -119,6 +132,7 @@ class StdMdspan(AugExpr, SupportsFieldExtraction):
         self._extents_type = extents_str
         self._layout_type = layout_policy
         self._dim = len(extents)
+        self._alignment = alignment
 
     @property
     def element_type(self) -> PsType:
@@ -132,6 +146,11 @@ class StdMdspan(AugExpr, SupportsFieldExtraction):
     def layout_type(self) -> str:
         return self._layout_type
 
+    @property
+    def alignment(self) -> int | None:
+        """Guaranteed alignment of the data handle in bytes, if known."""
+        return self._alignment
+
     def extent(self, r: int | ExprLike) -> AugExpr:
         return AugExpr.format("{}.extent({})", self, r)
 
@@ -144,7 +163,7 @@ class StdMdspan(AugExpr, SupportsFieldExtraction):
     #   SupportsFieldExtraction protocol
 
     def _extract_ptr(self) -> AugExpr:
-        return self.data_handle()
+        return assume_aligned(self.data_handle(), self._alignment)
 
     def _extract_size(self, coordinate: int) -> AugExpr | None:
         if coordinate > self._dim:
@@ -165,6 +184,7 @@ class StdMdspan(AugExpr, SupportsFieldExtraction):
         layout_policy: str | None = None,
         ref: bool = False,
         const: bool = False,
+        alignment: int | None = None,
     ):
         """Creates a `std::mdspan` instance for a given pystencils field."""
         if isinstance(field.dtype, DynamicType):
@@ -187,6 +207,7 @@ class StdMdspan(AugExpr, SupportsFieldExtraction):
             layout_policy=layout_policy,
             ref=ref,
             const=const,
+            alignment=alignment,
         ).var(field.name)
 
 
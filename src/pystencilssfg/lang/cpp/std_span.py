@@ -1,24 +1,36 @@
 from pystencils import Field, DynamicType
 from pystencils.types import UserTypeSpec, create_type, PsType
 
-from ...lang import SupportsFieldExtraction, AugExpr, cpptype
+from ...lang import SupportsFieldExtraction, AugExpr, cpptype, assume_aligned
 
 
 class StdSpan(AugExpr, SupportsFieldExtraction):
     _template = cpptype("std::span< {T} >", "<span>")
 
-    def __init__(self, T: UserTypeSpec, ref=False, const=False):
+    def __init__(
+        self,
+        T: UserTypeSpec,
+        ref=False,
+        const=False,
+        alignment: int | None = None,
+    ):
         T = create_type(T)
         dtype = self._template(T=T, const=const, ref=ref)
         self._element_type = T
+        self._alignment = alignment
         super().__init__(dtype)
 
     @property
     def element_type(self) -> PsType:
         return self._element_type
 
+    @property
+    def alignment(self) -> int | None:
+        """Guaranteed alignment of the span's data pointer in bytes, if known."""
+        return self._alignment
+
     def _extract_ptr(self) -> AugExpr:
-        return AugExpr.format("{}.data()", self)
+        return assume_aligned(AugExpr.format("{}.data()", self), self._alignment)
 
     def _extract_size(self, coordinate: int) -> AugExpr | None:
         if coordinate > 0:
@@ -33,7 +45,12 @@ class StdSpan(AugExpr, SupportsFieldExtraction):
             return AugExpr.format("1")
 
     @staticmethod
-    def from_field(field: Field, ref: bool = False, const: bool = False):
+    def from_field(
+        field: Field,
+        ref: bool = False,
+        const: bool = False,
+        alignment: int | None = None,
+    ):
         if field.spatial_dimensions > 1 or field.index_shape not in ((), (1,)):
             raise ValueError(
                 "Only one-dimensional fields with trivial index dimensions can be mapped onto `std::span`"
@@ -41,7 +58,9 @@ class StdSpan(AugExpr, SupportsFieldExtraction):
         if isinstance(field.dtype, DynamicType):
             raise ValueError("Cannot map dynamically typed field to std::span")
 
-        return StdSpan(field.dtype, ref=ref, const=const).var(field.name)
+        return StdSpan(field.dtype, ref=ref, const=const, alignment=alignment).var(
+            field.name
+        )
 
 
 def std_span_ref(field: Field):
@@ -1,11 +1,42 @@
 from pystencils import Field, DynamicType
 from pystencils.types import UserTypeSpec, create_type, PsType
 
-from ...lang import SupportsFieldExtraction, SupportsVectorExtraction, AugExpr, cpptype
+from ...lang import (
+    SupportsFieldExtraction,
+    SupportsVectorExtraction,
+    AugExpr,
+    cpptype,
+    assume_aligned,
+)
 
 
 class StdVector(AugExpr, SupportsFieldExtraction, SupportsVectorExtraction):
+    """Represents an ``std::vector`` instance.
+
+    Vectors using a custom allocator, e.g. one that produces over-aligned memory,
+    can be modelled by passing the allocator's type name as ``allocator``.
+    If the allocator guarantees a minimum alignment, specify it as ``alignment``
+    to have the extracted data pointer marked with ``std::assume_aligned``:
+
+    >>> from pystencilssfg.lang.cpp import std
+    >>> vec = std.vector("double", allocator="my::aligned_allocator< double, 64 >", alignment=64)
+    >>> vec.get_dtype().c_string()
+    'std::vector< double, my::aligned_allocator< double, 64 > >'
+
+    To have the generator provide an over-aligning allocator, use
+    `sfg.aligned_vector <SfgBasicComposer.aligned_vector>` instead.
+
+    Args:
+        T: Element type of the vector
+        unsafe: If `True`, vector components are accessed without bounds checks
+        ref: If `True`, model a reference to the vector
+        const: If `True`, model a ``const`` vector
+        allocator: Optional type name of the vector's allocator
+        alignment: Optional guaranteed alignment of the vector's data in bytes
+    """
+
     _template = cpptype("std::vector< {T} >", "<vector>")
+    _template_with_allocator = cpptype("std::vector< {T}, {Allocator} >", "<vector>")
 
     def __init__(
         self,
@@ -13,20 +44,75 @@ class StdVector(AugExpr, SupportsFieldExtraction, SupportsVectorExtraction):
         unsafe: bool = False,
         ref: bool = False,
         const: bool = False,
+        allocator: str | None = None,
+        alignment: int | None = None,
     ):
         T = create_type(T)
-        dtype = self._template(T=T, const=const, ref=ref)
+        if allocator is None:
+            dtype = self._template(T=T, const=const, ref=ref)
+        else:
+            dtype = self._template_with_allocator(
+                T=T, Allocator=allocator, const=const, ref=ref
+            )
         super().__init__(dtype)
 
         self._element_type = T
         self._unsafe = unsafe
+        self._alignment = alignment
+
+    @staticmethod
+    def aligned_allocator(T: UserTypeSpec, alignment: int) -> str:
+        """Type name of the over-aligning allocator defined by `aligned_allocator_definition`."""
+        return f"sfg_std::AlignedAllocator< {create_type(T).c_string()}, {alignment} >"
+
+    @staticmethod
+    def aligned_allocator_definition() -> str:
+        """Code defining the allocator template used by `aligned_allocator`.
+
+        The allocator obtains its memory from the aligned forms of ``operator new``
+        introduced in C++17.
+        """
+        guard = "PYSTENCILSSFG_ALIGNEDALLOCATOR_DEFINED"
+        return (
+            f"#ifndef {guard}\n"
+            f"#define {guard}\n"
+            "namespace sfg_std {\n"
+            "/** Allocator of memory aligned to `Alignment` bytes */\n"
+            "template< typename T, std::size_t Alignment >\n"
+            "struct AlignedAllocator {\n"
+            "  static_assert((Alignment & (Alignment - 1)) == 0, \"Alignment must be a power of two\");\n"
+            "  using value_type = T;\n"
+            "  template< typename U >\n"
+            "  struct rebind { using other = AlignedAllocator< U, Alignment >; };\n"
+            "  AlignedAllocator() noexcept = default;\n"
+            "  template< typename U >\n"
+            "  AlignedAllocator(const AlignedAllocator< U, Alignment > &) noexcept {}\n"
+            "  T * allocate(std::size_t n) {\n"
+            "    return static_cast< T * >(::operator new(n * sizeof(T), std::align_val_t(Alignment)));\n"
+            "  }\n"
+            "  void deallocate(T * ptr, std::size_t) noexcept {\n"
+            "    ::operator delete(ptr, std::align_val_t(Alignment));\n"
+            "  }\n"
+            "  template< typename U >\n"
+            "  bool operator==(const AlignedAllocator< U, Alignment > &) const noexcept { return true; }\n"
+            "  template< typename U >\n"
+            "  bool operator!=(const AlignedAllocator< U, Alignment > &) const noexcept { return false; }\n"
+            "};\n"
+            "}\n"
+            "#endif"
+        )
 
     @property
     def element_type(self) -> PsType:
         return self._element_type
 
+    @property
+    def alignment(self) -> int | None:
+        """Guaranteed alignment of the vector's data pointer in bytes, if known."""
+        return self._alignment
+
     def _extract_ptr(self) -> AugExpr:
-        return AugExpr.format("{}.data()", self)
+        return assume_aligned(AugExpr.format("{}.data()", self), self._alignment)
 
     def _extract_size(self, coordinate: int) -> AugExpr | None:
         if coordinate > 0:
@@ -47,7 +133,13 @@ class StdVector(AugExpr, SupportsFieldExtraction, SupportsVectorExtraction):
             return AugExpr.format("{}.at({})", self, coordinate)
 
     @staticmethod
-    def from_field(field: Field, ref: bool = True, const: bool = False):
+    def from_field(
+        field: Field,
+        ref: bool = True,
+        const: bool = False,
+        allocator: str | None = None,
+        alignment: int | None = None,
+    ):
         if field.spatial_dimensions > 1 or field.index_shape not in ((), (1,)):
             raise ValueError(
                 f"Cannot create std::vector from more-than-one-dimensional field {field}."
@@ -56,9 +148,14 @@ class StdVector(AugExpr, SupportsFieldExtraction, SupportsVectorExtraction):
         if isinstance(field.dtype, DynamicType):
             raise ValueError("Cannot map dynamically typed field to std::vector")
 
-        return StdVector(field.dtype, unsafe=False, ref=ref, const=const).var(
-            field.name
-        )
+        return StdVector(
+            field.dtype,
+            unsafe=False,
+            ref=ref,
+            const=const,
+            allocator=allocator,
+            alignment=alignment,
+        ).var(field.name)
 
 
 def std_vector_ref(field: Field):
@@ -1,3 +1,6 @@
-from .sycl_accessor import SyclAccessor
+from .sycl_accessor import SyclAccessor, SyclLocalAccessor
+from .sycl_usm import SyclUsmPointer
 
 accessor = SyclAccessor
+local_accessor = SyclLocalAccessor
+usm_pointer = SyclUsmPointer
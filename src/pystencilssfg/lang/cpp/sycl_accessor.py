@@ -1,7 +1,7 @@
 from pystencils import Field, DynamicType
 from pystencils.types import UserTypeSpec, create_type
 
-from ...lang import AugExpr, cpptype, SupportsFieldExtraction
+from ...lang import AugExpr, cpptype, SupportsFieldExtraction, assume_aligned
 
 
 class SyclAccessor(AugExpr, SupportsFieldExtraction):
@@ -23,6 +23,7 @@ class SyclAccessor(AugExpr, SupportsFieldExtraction):
         dimensions: int,
         ref: bool = False,
         const: bool = False,
+        alignment: int | None = None,
     ):
         T = create_type(T)
         if dimensions > 3:
@@ -33,11 +34,25 @@ class SyclAccessor(AugExpr, SupportsFieldExtraction):
 
         self._dim = dimensions
         self._inner_stride = 1
+        self._alignment = alignment
+
+    @property
+    def dimensions(self) -> int:
+        """Dimensionality of the accessor"""
+        return self._dim
+
+    @property
+    def alignment(self) -> int | None:
+        """Guaranteed alignment of the accessor's data pointer in bytes, if known."""
+        return self._alignment
 
     def _extract_ptr(self) -> AugExpr:
-        return AugExpr.format(
-            "{}.get_multi_ptr<sycl::access::decorated::no>().get()",
-            self,
+        return assume_aligned(
+            AugExpr.format(
+                "{}.get_multi_ptr<sycl::access::decorated::no>().get()",
+                self,
+            ),
+            self._alignment,
         )
 
     def _extract_size(self, coordinate: int) -> AugExpr | None:
@@ -62,7 +77,7 @@ class SyclAccessor(AugExpr, SupportsFieldExtraction):
             return AugExpr.format(expr, *args, self._inner_stride)
 
     @staticmethod
-    def from_field(field: Field, ref: bool = True):
+    def from_field(field: Field, ref: bool = True, alignment: int | None = None):
         """Creates a `sycl::accessor &` for a given pystencils field."""
 
         if isinstance(field.dtype, DynamicType):
@@ -72,4 +87,34 @@ class SyclAccessor(AugExpr, SupportsFieldExtraction):
             field.dtype,
             field.spatial_dimensions + field.index_dimensions,
             ref=ref,
+            alignment=alignment,
+        ).var(field.name)
+
+
+class SyclLocalAccessor(SyclAccessor):
+    """Represent a
+    `SYCL local accessor <https://registry.khronos.org/SYCL/specs/sycl-2020/html/sycl-2020.html#sec:accessor.local>`_,
+    which provides access to work-group local memory inside an ``nd_range`` kernel.
+
+    Local accessors must be constructed inside a command group;
+    use the ``local_memory`` argument of `SyclHandler.parallel_for <pystencilssfg.extensions.sycl.SyclHandler>`
+    to have them allocated before the kernel launch.
+    """  # noqa: E501
+
+    _template = cpptype("sycl::local_accessor< {T}, {dims} >", "<sycl/sycl.hpp>")
+
+    @staticmethod
+    def from_field(field: Field, ref: bool = False, alignment: int | None = None):
+        """Creates a `sycl::local_accessor` for a given pystencils field."""
+
+        if isinstance(field.dtype, DynamicType):
+            raise ValueError(
+                "Cannot map dynamically typed field to sycl::local_accessor"
+            )
+
+        return SyclLocalAccessor(
+            field.dtype,
+            field.spatial_dimensions + field.index_dimensions,
+            ref=ref,
+            alignment=alignment,
         ).var(field.name)
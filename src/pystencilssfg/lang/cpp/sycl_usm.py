@@ -0,0 +1,108 @@
+from pystencils import Field, DynamicType
+from pystencils.types import UserTypeSpec, PsPointerType, create_type, constify
+
+from ...lang import AugExpr, cpptype, SupportsFieldExtraction, assume_aligned
+
+
+class SyclUsmPointer(AugExpr, SupportsFieldExtraction):
+    """Represent a pointer to
+    `SYCL unified shared memory <https://registry.khronos.org/SYCL/specs/sycl-2020/html/sycl-2020.html#sec:usm>`_,
+    e.g. allocated through ``sycl::malloc_device``, together with a ``sycl::range`` describing its extents.
+
+    Unlike `SyclAccessor`, this bypasses the buffer/accessor model,
+    so kernels operating on USM pointers are ordered only through explicit ``sycl::event`` dependencies.
+    The memory is assumed to be contiguous and linearized in row-major order,
+    in the same way as SYCL buffers.
+
+    Args:
+        T: Element type
+        dimensions: Number of dimensions of the pointed-to array
+        range: Expression of type ``sycl::range< dimensions >`` describing the array's extents
+        const: Whether the pointed-to data is ``const``
+        alignment: Guaranteed alignment of the pointer in bytes, if known
+    """  # noqa: E501
+
+    _range_template = cpptype("sycl::range< {dims} >", "<sycl/sycl.hpp>")
+
+    def __init__(
+        self,
+        T: UserTypeSpec,
+        dimensions: int,
+        range: AugExpr,
+        const: bool = False,
+        alignment: int | None = None,
+    ):
+        T = create_type(T)
+        if dimensions > 3:
+            raise ValueError("SYCL ranges can only have dims 1, 2 or 3")
+
+        dtype = PsPointerType(constify(T) if const else T, restrict=False)
+        super().__init__(dtype)
+
+        self._dim = dimensions
+        self._range = range
+        self._alignment = alignment
+
+    @property
+    def dimensions(self) -> int:
+        """Dimensionality of the pointed-to array"""
+        return self._dim
+
+    @property
+    def range(self) -> AugExpr:
+        """The ``sycl::range`` describing the array's extents"""
+        return self._range
+
+    @property
+    def alignment(self) -> int | None:
+        """Guaranteed alignment of the data pointer in bytes, if known."""
+        return self._alignment
+
+    def _extract_ptr(self) -> AugExpr:
+        return assume_aligned(AugExpr.format("{}", self), self._alignment)
+
+    def _extract_size(self, coordinate: int) -> AugExpr | None:
+        if coordinate >= self._dim:
+            return None
+        else:
+            return AugExpr.format("{}.get({})", self._range, coordinate)
+
+    def _extract_stride(self, coordinate: int) -> AugExpr | None:
+        if coordinate >= self._dim:
+            return None
+        elif coordinate == self._dim - 1:
+            return AugExpr.format("1")
+        else:
+            exprs = []
+            args = []
+            for d in range(coordinate + 1, self._dim):
+                args.extend([self._range, d])
+                exprs.append("{}.get({})")
+            return AugExpr.format(" * ".join(exprs), *args)
+
+    @staticmethod
+    def from_field(
+        field: Field,
+        range_name: str | None = None,
+        const: bool = False,
+        alignment: int | None = None,
+    ):
+        """Creates a USM pointer and an associated ``sycl::range`` for the given pystencils field.
+
+        The pointer is named after the field, while the range is named ``<field>_range``
+        unless ``range_name`` is given.
+        """
+
+        if isinstance(field.dtype, DynamicType):
+            raise ValueError("Cannot map dynamically typed field to a USM pointer")
+
+        dims = field.spatial_dimensions + field.index_dimensions
+        if range_name is None:
+            range_name = f"{field.name}_range"
+
+        range_type = SyclUsmPointer._range_template(dims=dims, const=True, ref=True)
+        range = AugExpr(range_type).var(range_name)
+
+        return SyclUsmPointer(
+            field.dtype, dims, range, const=const, alignment=alignment
+        ).var(field.name)
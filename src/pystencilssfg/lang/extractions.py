@@ -53,6 +53,30 @@ class SupportsFieldExtraction(Protocol):
 #  how-to-guide end
 
 
+def assume_aligned(ptr: AugExpr, alignment: int | None) -> AugExpr:
+    """Wrap a pointer expression in ``std::assume_aligned``.
+
+    Field extractions use this to communicate the alignment of a field's base pointer
+    to the C++ compiler.
+
+    Args:
+        ptr: The pointer expression
+        alignment: Alignment of the pointer in bytes; if `None`, ``ptr`` is returned unchanged
+
+    Raises:
+        ValueError: If ``alignment`` is not a positive power of two
+    """
+    if alignment is None:
+        return ptr
+
+    if alignment <= 0 or (alignment & (alignment - 1)) != 0:
+        raise ValueError(f"Alignment must be a positive power of two, but was {alignment}")
+
+    return AugExpr(ptr.dtype).bind(
+        "std::assume_aligned< {} >( {} )", alignment, ptr, require_headers=["<memory>"]
+    )
+
+
 @runtime_checkable
 class SupportsVectorExtraction(Protocol):
     """Protocol for component extraction from a vector.
@@ -2,7 +2,9 @@ from __future__ import annotations
 
 from typing import Protocol
 
-from .expressions import CppClass, cpptype, AugExpr
+from pystencils.types import UserTypeSpec, create_type
+
+from .expressions import CppClass, cpptype, AugExpr, ExprLike
 
 
 class Dim3Interface(CppClass):
@@ -42,10 +44,330 @@ class ProvidesGpuRuntimeAPI(Protocol):
     stream_t: type[AugExpr]
     """The ``stream_t`` type for this GPU runtime"""
 
+    graph_t: type[AugExpr]
+    """The ``graph_t`` type for this GPU runtime"""
+
+    graph_exec_t: type[AugExpr]
+    """The ``graphExec_t`` type for this GPU runtime"""
+
+    event_t: type[AugExpr]
+    """The ``event_t`` type for this GPU runtime"""
+
+    runtime_header: str
+    """The header file declaring this GPU runtime's API"""
+
+    success: str
+    """The error code signalling success of a runtime API call"""
+
+    graph_update_failure: str
+    """The error code signalling that an executable graph could not be updated from a changed graph"""
+
+    @classmethod
+    def occupancy_max_potential_block_size(
+        cls,
+        min_grid_size: ExprLike,
+        block_size: ExprLike,
+        func: ExprLike,
+        dynamic_smem_bytes: ExprLike = "0",
+    ) -> AugExpr:
+        """Invocation of ``OccupancyMaxPotentialBlockSize`` for this GPU runtime.
+
+        Args:
+            min_grid_size: Pointer to an ``int`` receiving the minimum grid size for full occupancy
+            block_size: Pointer to an ``int`` receiving the block size
+            func: The kernel function
+            dynamic_smem_bytes: Number of bytes of dynamic shared memory used per block
+        """
+        ...
+
+    @classmethod
+    def device_synchronize(cls) -> AugExpr:
+        """Invocation of ``DeviceSynchronize``."""
+        ...
+
+    @classmethod
+    def event_record(cls, event: ExprLike, stream: ExprLike) -> AugExpr:
+        """Invocation of ``EventRecord``, recording ``event`` on ``stream``."""
+        ...
+
+    @classmethod
+    def event_create(cls, event: ExprLike) -> AugExpr:
+        """Invocation of ``EventCreate``, creating a new event in ``event``."""
+        ...
+
+    @classmethod
+    def event_synchronize(cls, event: ExprLike) -> AugExpr:
+        """Invocation of ``EventSynchronize``, waiting for ``event`` to complete."""
+        ...
+
+    @classmethod
+    def event_elapsed_time(
+        cls, milliseconds: ExprLike, start: ExprLike, stop: ExprLike
+    ) -> AugExpr:
+        """Invocation of ``EventElapsedTime``, storing the time between the
+        ``start`` and ``stop`` events in the ``float`` variable ``milliseconds``."""
+        ...
+
+    @classmethod
+    def event_destroy(cls, event: ExprLike) -> AugExpr:
+        """Invocation of ``EventDestroy``."""
+        ...
+
+    @classmethod
+    def stream_begin_capture(cls, stream: ExprLike) -> AugExpr:
+        """Invocation of ``StreamBeginCapture`` in thread-local capture mode."""
+        ...
+
+    @classmethod
+    def stream_end_capture(cls, stream: ExprLike, graph: ExprLike) -> AugExpr:
+        """Invocation of ``StreamEndCapture``, storing the captured graph in ``graph``."""
+        ...
+
+    @classmethod
+    def graph_instantiate(cls, graph_exec: ExprLike, graph: ExprLike) -> AugExpr:
+        """Invocation of ``GraphInstantiateWithFlags``, storing the executable graph in ``graph_exec``."""
+        ...
+
+    @classmethod
+    def graph_exec_update(cls, graph_exec: ExprLike, graph: ExprLike) -> AugExpr:
+        """Expression that attempts to update the node parameters of ``graph_exec``
+        from ``graph`` using ``GraphExecUpdate``, and evaluates to its error code."""
+        ...
+
+    @classmethod
+    def graph_launch(cls, graph_exec: ExprLike, stream: ExprLike) -> AugExpr:
+        """Invocation of ``GraphLaunch``."""
+        ...
+
+    @classmethod
+    def graph_destroy(cls, graph: ExprLike) -> AugExpr:
+        """Invocation of ``GraphDestroy``."""
+        ...
+
+    @classmethod
+    def graph_exec_destroy(cls, graph_exec: ExprLike) -> AugExpr:
+        """Invocation of ``GraphExecDestroy``."""
+        ...
+
+    @classmethod
+    def memcpy_async(
+        cls,
+        dst: ExprLike,
+        src: ExprLike,
+        count: ExprLike,
+        kind: str,
+        stream: ExprLike,
+    ) -> AugExpr:
+        """Invocation of ``MemcpyAsync``, copying ``count`` bytes from ``src`` to ``dst`` on ``stream``.
+
+        Args:
+            kind: The direction of the copy; one of ``HostToDevice``, ``DeviceToHost``,
+                ``DeviceToDevice``, ``HostToHost``, or ``Default``
+        """
+        ...
+
+    @classmethod
+    def mem_prefetch_async(
+        cls, ptr: ExprLike, count: ExprLike, device: ExprLike, stream: ExprLike
+    ) -> AugExpr:
+        """Invocation of ``MemPrefetchAsync``, migrating ``count`` bytes of managed memory
+        starting at ``ptr`` to ``device`` on ``stream``."""
+        ...
+
+    @classmethod
+    def pinned_allocator(cls, T: UserTypeSpec) -> str:
+        """Name of an allocator type for elements of type ``T`` producing page-locked host memory.
+
+        The allocator is defined by the code returned from `pinned_allocator_definition`.
+        """
+        ...
+
+    @classmethod
+    def pinned_allocator_definition(cls) -> str:
+        """Code defining the allocator template used by `pinned_allocator`."""
+        ...
+
+
+class _GpuRuntimeAPIBase:
+    """Implements the runtime function reflections of `ProvidesGpuRuntimeAPI`,
+    whose names differ between CUDA and HIP only by their prefix."""
+
+    _prefix: str
+    _header: str
+
+    @classmethod
+    def _call(cls, func: str, *args: ExprLike) -> AugExpr:
+        argslist = ", ".join("{}" for _ in args)
+        return AugExpr().bind(
+            f"{cls._prefix}{func}({argslist})", *args, require_headers=[cls._header]
+        )
+
+    @classmethod
+    def occupancy_max_potential_block_size(
+        cls,
+        min_grid_size: ExprLike,
+        block_size: ExprLike,
+        func: ExprLike,
+        dynamic_smem_bytes: ExprLike = "0",
+    ) -> AugExpr:
+        return cls._call(
+            "OccupancyMaxPotentialBlockSize",
+            min_grid_size,
+            block_size,
+            func,
+            dynamic_smem_bytes,
+        )
 
-class CudaAPI(ProvidesGpuRuntimeAPI):
+    @classmethod
+    def device_synchronize(cls) -> AugExpr:
+        return cls._call("DeviceSynchronize")
+
+    @classmethod
+    def event_record(cls, event: ExprLike, stream: ExprLike) -> AugExpr:
+        return cls._call("EventRecord", event, stream)
+
+    @classmethod
+    def event_create(cls, event: ExprLike) -> AugExpr:
+        return cls._call("EventCreate", AugExpr.format("&{}", event))
+
+    @classmethod
+    def event_synchronize(cls, event: ExprLike) -> AugExpr:
+        return cls._call("EventSynchronize", event)
+
+    @classmethod
+    def event_elapsed_time(
+        cls, milliseconds: ExprLike, start: ExprLike, stop: ExprLike
+    ) -> AugExpr:
+        return cls._call(
+            "EventElapsedTime", AugExpr.format("&{}", milliseconds), start, stop
+        )
+
+    @classmethod
+    def event_destroy(cls, event: ExprLike) -> AugExpr:
+        return cls._call("EventDestroy", event)
+
+    @classmethod
+    def stream_begin_capture(cls, stream: ExprLike) -> AugExpr:
+        return cls._call(
+            "StreamBeginCapture", stream, f"{cls._prefix}StreamCaptureModeThreadLocal"
+        )
+
+    @classmethod
+    def stream_end_capture(cls, stream: ExprLike, graph: ExprLike) -> AugExpr:
+        return cls._call("StreamEndCapture", stream, AugExpr.format("&{}", graph))
+
+    @classmethod
+    def graph_instantiate(cls, graph_exec: ExprLike, graph: ExprLike) -> AugExpr:
+        return cls._call(
+            "GraphInstantiateWithFlags", AugExpr.format("&{}", graph_exec), graph, "0"
+        )
+
+    @classmethod
+    def graph_exec_update(cls, graph_exec: ExprLike, graph: ExprLike) -> AugExpr:
+        return AugExpr().bind(
+            "[&]() {{\n"
+            "  {p}GraphNode_t __error_node;\n"
+            "  {p}GraphExecUpdateResult __update_result;\n"
+            "  return {p}GraphExecUpdate({exec}, {graph}, &__error_node, &__update_result);\n"
+            "}}()",
+            p=cls._prefix,
+            exec=graph_exec,
+            graph=graph,
+            require_headers=[cls._header],
+        )
+
+    @classmethod
+    def graph_launch(cls, graph_exec: ExprLike, stream: ExprLike) -> AugExpr:
+        return cls._call("GraphLaunch", graph_exec, stream)
+
+    @classmethod
+    def graph_destroy(cls, graph: ExprLike) -> AugExpr:
+        return cls._call("GraphDestroy", graph)
+
+    @classmethod
+    def graph_exec_destroy(cls, graph_exec: ExprLike) -> AugExpr:
+        return cls._call("GraphExecDestroy", graph_exec)
+
+    _memcpy_kinds = (
+        "HostToDevice",
+        "DeviceToHost",
+        "DeviceToDevice",
+        "HostToHost",
+        "Default",
+    )
+
+    @classmethod
+    def memcpy_async(
+        cls,
+        dst: ExprLike,
+        src: ExprLike,
+        count: ExprLike,
+        kind: str,
+        stream: ExprLike,
+    ) -> AugExpr:
+        if kind not in cls._memcpy_kinds:
+            raise ValueError(
+                f"Invalid memcpy kind: {kind}. Must be one of {', '.join(cls._memcpy_kinds)}."
+            )
+        return cls._call(
+            "MemcpyAsync", dst, src, count, f"{cls._prefix}Memcpy{kind}", stream
+        )
+
+    @classmethod
+    def mem_prefetch_async(
+        cls, ptr: ExprLike, count: ExprLike, device: ExprLike, stream: ExprLike
+    ) -> AugExpr:
+        return cls._call("MemPrefetchAsync", ptr, count, device, stream)
+
+    _pinned_allocator_name: str
+    _pinned_malloc: str
+    _pinned_free: str
+
+    @classmethod
+    def pinned_allocator(cls, T: UserTypeSpec) -> str:
+        return f"sfg_gpu::{cls._pinned_allocator_name}< {create_type(T).c_string()} >"
+
+    @classmethod
+    def pinned_allocator_definition(cls) -> str:
+        name = cls._pinned_allocator_name
+        guard = f"PYSTENCILSSFG_{name.upper()}_DEFINED"
+        return (
+            f"#ifndef {guard}\n"
+            f"#define {guard}\n"
+            "namespace sfg_gpu {\n"
+            "/** Allocator of page-locked host memory, for asynchronous host/device transfers */\n"
+            "template< typename T >\n"
+            f"struct {name} {{\n"
+            "  using value_type = T;\n"
+            f"  {name}() noexcept = default;\n"
+            "  template< typename U >\n"
+            f"  {name}(const {name}< U > &) noexcept {{}}\n"
+            "  T * allocate(std::size_t n) {\n"
+            "    void * ptr { nullptr };\n"
+            f"    if ({cls._pinned_malloc.format(ptr='&ptr', bytes='n * sizeof(T)')} != {cls._prefix}Success) {{\n"
+            "      throw std::bad_alloc();\n"
+            "    }\n"
+            "    return static_cast< T * >(ptr);\n"
+            "  }\n"
+            f"  void deallocate(T * ptr, std::size_t) noexcept {{ {cls._pinned_free}(ptr); }}\n"
+            "  template< typename U >\n"
+            f"  bool operator==(const {name}< U > &) const noexcept {{ return true; }}\n"
+            "  template< typename U >\n"
+            f"  bool operator!=(const {name}< U > &) const noexcept {{ return false; }}\n"
+            "};\n"
+            "}\n"
+            "#endif"
+        )
+
+
+class CudaAPI(_GpuRuntimeAPIBase, ProvidesGpuRuntimeAPI):
     """Reflection of the CUDA runtime API"""
 
+    _prefix = "cuda"
+    _header = runtime_header = "<cuda_runtime.h>"
+    success = "cudaSuccess"
+    graph_update_failure = "cudaErrorGraphExecUpdateFailure"
+
     class dim3(Dim3Interface):
         """Implements `Dim3Interface` for CUDA"""
 
@@ -54,14 +376,76 @@ class CudaAPI(ProvidesGpuRuntimeAPI):
     class stream_t(CppClass):
         template = cpptype("cudaStream_t", "<cuda_runtime.h>")
 
+    class graph_t(CppClass):
+        template = cpptype("cudaGraph_t", "<cuda_runtime.h>")
+
+    class graph_exec_t(CppClass):
+        template = cpptype("cudaGraphExec_t", "<cuda_runtime.h>")
+
+    class event_t(CppClass):
+        template = cpptype("cudaEvent_t", "<cuda_runtime.h>")
+
+    _pinned_allocator_name = "CudaPinnedAllocator"
+    _pinned_malloc = "cudaMallocHost({ptr}, {bytes})"
+    _pinned_free = "cudaFreeHost"
+
+    @classmethod
+    def mem_prefetch_async(
+        cls, ptr: ExprLike, count: ExprLike, device: ExprLike, stream: ExprLike
+    ) -> AugExpr:
+        #   CUDA 13 replaced the destination device by a memory location and added a flags argument
+        return AugExpr().bind(
+            "[&]() {{\n"
+            "#if CUDART_VERSION >= 13000\n"
+            "  return cudaMemPrefetchAsync({ptr}, {count}, "
+            "cudaMemLocation {{ cudaMemLocationTypeDevice, {device} }}, 0, {stream});\n"
+            "#else\n"
+            "  return cudaMemPrefetchAsync({ptr}, {count}, {device}, {stream});\n"
+            "#endif\n"
+            "}}()",
+            ptr=ptr,
+            count=count,
+            device=device,
+            stream=stream,
+            require_headers=[cls._header],
+        )
+
+    @classmethod
+    def graph_exec_update(cls, graph_exec: ExprLike, graph: ExprLike) -> AugExpr:
+        #   The signature of `cudaGraphExecUpdate` changed with CUDA 12
+        return AugExpr().bind(
+            "[&]() {{\n"
+            "#if CUDART_VERSION >= 12000\n"
+            "  cudaGraphExecUpdateResultInfo __update_info;\n"
+            "  return cudaGraphExecUpdate({exec}, {graph}, &__update_info);\n"
+            "#else\n"
+            "  cudaGraphNode_t __error_node;\n"
+            "  cudaGraphExecUpdateResult __update_result;\n"
+            "  return cudaGraphExecUpdate({exec}, {graph}, &__error_node, &__update_result);\n"
+            "#endif\n"
+            "}}()",
+            exec=graph_exec,
+            graph=graph,
+            require_headers=[cls._header],
+        )
+
 
 cuda = CudaAPI
 """Alias for `CudaAPI`"""
 
 
-class HipAPI(ProvidesGpuRuntimeAPI):
+class HipAPI(_GpuRuntimeAPIBase, ProvidesGpuRuntimeAPI):
     """Reflection of the HIP runtime API"""
 
+    _prefix = "hip"
+    _header = runtime_header = "<hip/hip_runtime.h>"
+    success = "hipSuccess"
+    graph_update_failure = "hipErrorGraphExecUpdateFailure"
+
+    _pinned_allocator_name = "HipPinnedAllocator"
+    _pinned_malloc = "hipHostMalloc({ptr}, {bytes}, hipHostMallocDefault)"
+    _pinned_free = "hipHostFree"
+
     class dim3(Dim3Interface):
         """Implements `Dim3Interface` for HIP"""
 
@@ -70,6 +454,15 @@ class HipAPI(ProvidesGpuRuntimeAPI):
     class stream_t(CppClass):
         template = cpptype("hipStream_t", "<hip/hip_runtime.h>")
 
+    class graph_t(CppClass):
+        template = cpptype("hipGraph_t", "<hip/hip_runtime.h>")
+
+    class graph_exec_t(CppClass):
+        template = cpptype("hipGraphExec_t", "<hip/hip_runtime.h>")
+
+    class event_t(CppClass):
+        template = cpptype("hipEvent_t", "<hip/hip_runtime.h>")
+
 
 hip = HipAPI
 """Alias for `HipAPI`"""
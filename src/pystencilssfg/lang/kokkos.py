@@ -0,0 +1,265 @@
+from __future__ import annotations
+
+from typing import cast
+from sympy import Symbol
+
+from pystencils import Field, DynamicType, Target
+from pystencils.types import PsType, UserTypeSpec, create_type
+
+from .expressions import AugExpr
+from .extractions import SupportsFieldExtraction, assume_aligned
+from .types import cpptype
+
+
+class KokkosView(AugExpr, SupportsFieldExtraction):
+    """Represents a `Kokkos::View <https://kokkos.org/kokkos-core-wiki/API/core/view/view.html>`_ instance.
+
+    The view's data type is built from its element type and extents:
+    dynamic extents are written as pointer stars, and fixed extents as array bounds.
+    Since Kokkos requires all runtime extents to precede all compile-time extents,
+    only a trailing sequence of fixed extents can be made static;
+    fixed extents preceding any dynamic extent are treated as dynamic.
+
+    >>> from pystencilssfg.lang import kokkos
+    >>> view = kokkos.View("double", (None, None, 3), layout="Kokkos::LayoutRight")
+    >>> view.get_dtype().c_string()
+    'Kokkos::View< double**[3], Kokkos::LayoutRight >'
+
+    **Layouts**
+
+    When creating a view through `from_field`, its layout is inferred from the field's memory layout
+    if not given explicitly:
+
+    +------------------------+------------------------------+
+    | pystencils Layout Name | Kokkos Layout                |
+    +========================+==============================+
+    | ``"fzyx"``             | ``Kokkos::LayoutLeft``       |
+    | ``"soa"``              |                              |
+    | ``"f"``                |                              |
+    | ``"reverse_numpy"``    |                              |
+    +------------------------+------------------------------+
+    | ``"c"``                | ``Kokkos::LayoutRight``      |
+    | ``"numpy"``            |                              |
+    +------------------------+------------------------------+
+    | ``"zyxf"``             | ``Kokkos::LayoutStride``     |
+    | ``"aos"``              |                              |
+    +------------------------+------------------------------+
+
+    **Memory Spaces**
+
+    If a memory space is specified, `compatible_with` reports whether kernels for a given target
+    may access the view's data.
+    Passing a ``target`` to `from_field` raises an error if the memory space is not accessible by that target.
+
+    **Alignment**
+
+    If the view's data is known to be over-aligned, pass its alignment in bytes as ``alignment``.
+    The extracted data pointer will then be marked with ``std::assume_aligned``.
+
+    Args:
+        T: Element type of the view
+        extents: Extents of the view; `None` stands for a dynamic extent
+        layout: Fully qualified name of the view's layout, e.g. ``Kokkos::LayoutRight``
+        memory_space: Fully qualified name of the view's memory space, e.g. ``Kokkos::CudaSpace``
+        ref: If `True`, model a reference to the view
+        const: If `True`, model a ``const`` view
+        alignment: Optional guaranteed alignment of the view's data in bytes
+    """
+
+    layouts = ("Kokkos::LayoutLeft", "Kokkos::LayoutRight", "Kokkos::LayoutStride")
+
+    #   Targets whose kernels may access each of the memory spaces;
+    #   memory spaces not listed here (e.g. `Kokkos::SharedSpace`) are accessible by all targets
+    _memory_space_targets: dict[str, tuple[str, ...]] = {
+        "Kokkos::HostSpace": ("cpu",),
+        "Kokkos::CudaSpace": ("cuda",),
+        "Kokkos::CudaUVMSpace": ("cpu", "cuda"),
+        "Kokkos::CudaHostPinnedSpace": ("cpu", "cuda"),
+        "Kokkos::HIPSpace": ("hip",),
+        "Kokkos::HIPManagedSpace": ("cpu", "hip"),
+        "Kokkos::HIPHostPinnedSpace": ("cpu", "hip"),
+    }
+
+    _template = cpptype("Kokkos::View< {args} >", "<Kokkos_Core.hpp>")
+
+    def __init__(
+        self,
+        T: UserTypeSpec,
+        extents: tuple[int | None, ...],
+        layout: str | None = None,
+        memory_space: str | None = None,
+        ref: bool = False,
+        const: bool = False,
+        alignment: int | None = None,
+    ):
+        T = create_type(T)
+
+        if layout is not None and layout not in self.layouts:
+            raise ValueError(
+                f"Invalid Kokkos layout: {layout}. Must be one of {', '.join(self.layouts)}."
+            )
+
+        #   Only a trailing sequence of fixed extents can be static
+        n_dynamic = len(extents)
+        while n_dynamic > 0 and extents[n_dynamic - 1] is not None:
+            n_dynamic -= 1
+        static_extents = extents[n_dynamic:]
+
+        data_type = (
+            T.c_string() + "*" * n_dynamic + "".join(f"[{e}]" for e in static_extents)
+        )
+        args = ", ".join(
+            [data_type] + [a for a in (layout, memory_space) if a is not None]
+        )
+
+        dtype = self._template(args=args, const=const, ref=ref)
+        super().__init__(dtype)
+
+        self._element_type = T
+        self._extents = extents
+        self._static_extents = (None,) * n_dynamic + tuple(static_extents)
+        self._layout = layout
+        self._memory_space = memory_space
+        self._alignment = alignment
+
+    @property
+    def element_type(self) -> PsType:
+        return self._element_type
+
+    @property
+    def rank(self) -> int:
+        return len(self._extents)
+
+    @property
+    def static_extents(self) -> tuple[int | None, ...]:
+        """The view's compile-time extents; `None` for each runtime extent."""
+        return self._static_extents
+
+    @property
+    def layout(self) -> str | None:
+        return self._layout
+
+    @property
+    def memory_space(self) -> str | None:
+        return self._memory_space
+
+    @property
+    def alignment(self) -> int | None:
+        """Guaranteed alignment of the view's data pointer in bytes, if known."""
+        return self._alignment
+
+    def compatible_with(self, target: Target) -> bool:
+        """Whether kernels for the given target can access this view's memory space."""
+        if self._memory_space is None:
+            return True
+
+        accessible_by = self._memory_space_targets.get(self._memory_space)
+        if accessible_by is None:
+            return True
+
+        if target.is_cpu():
+            return "cpu" in accessible_by
+        elif target == Target.CUDA:
+            return "cuda" in accessible_by
+        elif target == Target.HIP:
+            return "hip" in accessible_by
+        else:
+            return False
+
+    def extent(self, r: int) -> AugExpr:
+        return AugExpr.format("{}.extent({})", self, r)
+
+    def stride(self, r: int) -> AugExpr:
+        return AugExpr.format("{}.stride({})", self, r)
+
+    def data(self) -> AugExpr:
+        return AugExpr.format("{}.data()", self)
+
+    #   SupportsFieldExtraction protocol
+
+    def _extract_ptr(self) -> AugExpr:
+        return assume_aligned(self.data(), self._alignment)
+
+    def _extract_size(self, coordinate: int) -> AugExpr | None:
+        if coordinate >= self.rank:
+            return None
+        elif (e := self._static_extents[coordinate]) is not None:
+            return AugExpr.format(str(e))
+        else:
+            return self.extent(coordinate)
+
+    def _extract_stride(self, coordinate: int) -> AugExpr | None:
+        if coordinate >= self.rank:
+            return None
+        else:
+            return self.stride(coordinate)
+
+    @staticmethod
+    def layout_of(field: Field) -> str:
+        """The Kokkos layout matching the memory layout of the given field."""
+        layout = tuple(field.layout)
+        if layout == tuple(range(len(layout))):
+            return "Kokkos::LayoutRight"
+        elif layout == tuple(reversed(range(len(layout)))):
+            return "Kokkos::LayoutLeft"
+        else:
+            return "Kokkos::LayoutStride"
+
+    @staticmethod
+    def from_field(
+        field: Field,
+        layout: str | None = None,
+        memory_space: str | None = None,
+        target: Target | None = None,
+        ref: bool = False,
+        const: bool = False,
+        alignment: int | None = None,
+    ):
+        """Creates a ``Kokkos::View`` instance for a given pystencils field.
+
+        Each fixed entry in the field's trailing shape becomes a static extent of the view.
+
+        Args:
+            field: The field to create the view for
+            layout: The view's layout; if not given, it is inferred from the field's memory layout.
+                ``Kokkos::LayoutLeft`` and ``Kokkos::LayoutRight`` are only permitted
+                if they match the field's memory layout.
+            memory_space: The view's memory space
+            target: If given, the target of the kernels accessing the field;
+                must be able to access ``memory_space``
+        """
+        if isinstance(field.dtype, DynamicType):
+            raise ValueError("Cannot map dynamically typed field to Kokkos::View")
+
+        field_layout = KokkosView.layout_of(field)
+        if layout is None:
+            layout = field_layout
+        elif layout != "Kokkos::LayoutStride" and layout != field_layout:
+            raise ValueError(
+                f"Kokkos layout {layout} does not match the memory layout of field {field}"
+            )
+
+        extents: list[int | None] = [
+            None if isinstance(s, Symbol) else cast(int, s) for s in field.shape
+        ]
+
+        view = KokkosView(
+            field.dtype,
+            tuple(extents),
+            layout=layout,
+            memory_space=memory_space,
+            ref=ref,
+            const=const,
+            alignment=alignment,
+        )
+
+        if target is not None and not view.compatible_with(target):
+            raise ValueError(
+                f"Memory space {memory_space} is not accessible by kernels for target {target}"
+            )
+
+        return view.var(field.name)
+
+
+View = KokkosView
+"""Alias for `KokkosView`"""
@@ -0,0 +1,29 @@
+import sympy as sp
+
+from pystencils import Assignment, fields
+
+from pystencilssfg.composer.basic_composer import kernel_metadata
+
+
+def test_flop_count(sfg):
+    src, dst = fields("src, dst: double[2D]")
+    h = sp.Symbol("h")
+
+    smooth = sfg.kernels.create(
+        Assignment(dst[0, 0], h * (h**2 * src[0, 0] + src[1, 0] + src[-1, 0])),
+        "smooth",
+    )
+    #   One power, two multiplications and two additions
+    assert kernel_metadata(smooth).flops == 5
+
+    #   Divisions are counted once, not as a multiplication and a reciprocal
+    quotient = sfg.kernels.create(
+        Assignment(dst[0, 0], src[1, 0] / (src[-1, 0] + 1)), "quotient"
+    )
+    assert kernel_metadata(quotient).flops == 2
+
+    negated = sfg.kernels.create(
+        Assignment(dst[0, 0], -src[1, 0] / (src[-1, 0] * src[0, 1] ** 2)), "negated"
+    )
+    #   One division by each denominator factor, and one power
+    assert kernel_metadata(negated).flops == 3
@@ -0,0 +1,158 @@
+import os
+
+from pystencilssfg.config import ClangFormatOptions
+from pystencilssfg.emission import SfgCodeEmitter
+from pystencilssfg.ir import SfgSourceFile, SfgSourceFileType
+
+
+def test_write_if_changed(tmp_path):
+    clang_format = ClangFormatOptions()
+    clang_format.skip = True
+    emitter = SfgCodeEmitter(tmp_path, clang_format=clang_format)
+
+    file = SfgSourceFile("test.hpp", SfgSourceFileType.HEADER)
+    file.elements.append("#define SOMETHING")
+
+    assert emitter.emit(file)
+    fpath = tmp_path / "test.hpp"
+    assert fpath.exists()
+
+    #   Backdate the file to detect any rewrite
+    os.utime(fpath, (0, 0))
+
+    assert not emitter.emit(file)
+    assert fpath.stat().st_mtime == 0
+
+    file.elements.append("#define SOMETHING_ELSE")
+    assert emitter.emit(file)
+    assert fpath.stat().st_mtime != 0
+    assert "#define SOMETHING_ELSE" in fpath.read_text()
+
+
+FAKE_CLANG_FORMAT = """#!{python}
+import sys
+
+with open({log!r}, "a") as log:
+    log.write(" ".join(sys.argv[1:]) + "\\n")
+
+paths = [arg for arg in sys.argv[1:] if not arg.startswith("-")]
+if "-i" in sys.argv:
+    for path in paths:
+        with open(path) as f:
+            code = f.read()
+        with open(path, "w") as f:
+            f.write("// formatted\\n" + code)
+else:
+    sys.stdout.write("// formatted\\n" + sys.stdin.read())
+"""
+
+
+def make_fake_clang_format(tmp_path):
+    import sys
+
+    log = tmp_path / "clang-format.log"
+    binary = tmp_path / "fake-clang-format"
+    binary.write_text(FAKE_CLANG_FORMAT.format(python=sys.executable, log=str(log)))
+    binary.chmod(0o755)
+    return binary, log
+
+
+def test_batched_formatting(tmp_path, monkeypatch):
+    binary, log = make_fake_clang_format(tmp_path)
+    monkeypatch.chdir(tmp_path)
+
+    clang_format = ClangFormatOptions()
+    clang_format.binary = str(binary)
+    clang_format.force = True
+    clang_format.jobs = 2
+
+    outdir = tmp_path / "out"
+    emitter = SfgCodeEmitter(outdir, clang_format=clang_format)
+
+    files = []
+    for i in range(5):
+        file = SfgSourceFile(f"test{i}.cpp", SfgSourceFileType.TRANSLATION_UNIT)
+        file.elements.append(f"#define SOMETHING_{i}")
+        files.append(file)
+
+    assert emitter.emit_all(files) == [True] * 5
+    for i in range(5):
+        code = (outdir / f"test{i}.cpp").read_text()
+        assert code.startswith("// formatted\n")
+        assert f"#define SOMETHING_{i}" in code
+
+    #   Five files formatted by two concurrent processes
+    assert len(log.read_text().splitlines()) == 2
+
+    #   No temporary files are left behind in the working directory
+    assert not list(tmp_path.glob("*sfg-clang-format*"))
+
+
+def test_style_file(tmp_path, monkeypatch):
+    binary, log = make_fake_clang_format(tmp_path)
+
+    style_file = tmp_path / ".clang-format"
+    style_file.write_text("BasedOnStyle: LLVM\n")
+    workdir = tmp_path / "build"
+    workdir.mkdir()
+    monkeypatch.chdir(workdir)
+
+    clang_format = ClangFormatOptions()
+    clang_format.binary = str(binary)
+    clang_format.cache = True
+
+    outdir = tmp_path / "out"
+    emitter = SfgCodeEmitter(outdir, clang_format=clang_format)
+
+    files = []
+    for i in range(2):
+        file = SfgSourceFile(f"test{i}.cpp", SfgSourceFileType.TRANSLATION_UNIT)
+        file.elements.append(f"#define SOMETHING_{i}")
+        files.append(file)
+
+    #   The style file is discovered from the working directory and passed explicitly
+    emitter.emit_all(files)
+    invocations = log.read_text().splitlines()
+    assert len(invocations) == 1
+    assert f"--style=file:{style_file}" in invocations[0]
+
+    #   Changing the style file invalidates the format cache
+    emitter.emit_all(files)
+    assert len(log.read_text().splitlines()) == 1
+
+    style_file.write_text("BasedOnStyle: Google\n")
+    emitter.emit_all(files)
+    assert len(log.read_text().splitlines()) == 2
+
+
+def test_format_cache(tmp_path):
+    binary, log = make_fake_clang_format(tmp_path)
+
+    clang_format = ClangFormatOptions()
+    clang_format.binary = str(binary)
+    clang_format.cache = True
+
+    outdir = tmp_path / "out"
+    emitter = SfgCodeEmitter(outdir, clang_format=clang_format)
+
+    header = SfgSourceFile("test.hpp", SfgSourceFileType.HEADER)
+    header.elements.append("#define SOMETHING")
+    impl = SfgSourceFile("test.cpp", SfgSourceFileType.TRANSLATION_UNIT)
+    impl.elements.append("#define SOMETHING_ELSE")
+
+    assert emitter.emit_all([header, impl]) == [True, True]
+    assert len(log.read_text().splitlines()) == 1
+
+    #   Unchanged files are neither formatted nor rewritten
+    assert emitter.emit_all([header, impl]) == [False, False]
+    assert len(log.read_text().splitlines()) == 1
+
+    #   Only the changed file is formatted again
+    impl.elements.append("#define YET_ANOTHER_THING")
+    assert emitter.emit_all([header, impl]) == [False, True]
+    assert len(log.read_text().splitlines()) == 2
+
+    #   Tampered output files are regenerated
+    (outdir / "test.hpp").write_text("")
+    assert emitter.emit_all([header, impl]) == [True, False]
+    assert (outdir / "test.hpp").read_text().startswith("// formatted\n")
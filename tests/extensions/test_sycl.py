@@ -2,6 +2,11 @@ import pytest
 import pystencilssfg.extensions.sycl as sycl
 import pystencils as ps
 
+from pystencilssfg.exceptions import SfgException
+from pystencilssfg.composer import make_sequence
+from pystencilssfg.ir.postprocessing import CallTreePostProcessing
+from pystencilssfg.lang import asvar
+
 
 def test_parallel_for_1_kernels(sfg):
     sfg = sycl.SyclComposer(sfg)
@@ -60,3 +65,144 @@ def test_parallel_for_2_kernels_fail(sfg):
             sfg.call(kernel_1),
             sfg.call(kernel_2),
         )
+
+
+def test_parallel_for_nd_range(sfg):
+    sfg = sycl.SyclComposer(sfg)
+    f, g = ps.fields("f, g: double[2D]")
+    tile = ps.fields("tile: double[2D]")
+    asm = ps.Assignment(f.center(), g.center())
+
+    config = ps.CreateKernelConfig(target=ps.Target.SYCL)
+    config.sycl.automatic_block_size = False
+    khandle = sfg.kernels.create(asm, "kernel", config)
+
+    cgh = sfg.sycl_handler("handler")
+    rang = sfg.sycl_range(2, "range")
+    tile_acc = sycl.local_accessor.from_field(tile)
+
+    seq = cgh.parallel_for(
+        rang,
+        (16, 16),
+        local_memory=[(tile_acc, (16, 16))],
+        reqd_work_group_size=(16, 16),
+        reqd_sub_group_size=16,
+    )(
+        sfg.map_field(tile, tile_acc),
+        sfg.call(khandle),
+    )
+
+    code = seq.get_code(sfg.context.codestyle)
+    assert (
+        "sycl::local_accessor< double, 2 > tile { sycl::range< 2 >{ 16, 16 }, handler };"
+        in code
+    )
+    assert (
+        "handler.parallel_for(sycl::nd_range< 2 >{ range, sycl::range< 2 >{ 16, 16 } }"
+        in code
+    )
+    assert (
+        "[[sycl::reqd_work_group_size(16, 16), sycl::reqd_sub_group_size(16)]]" in code
+    )
+
+
+def test_parallel_for_nd_range_fail(sfg):
+    sfg = sycl.SyclComposer(sfg)
+    f, g = ps.fields("f, g: double[2D]")
+    asm = ps.Assignment(f.center(), g.center())
+
+    #   Kernel with automatic block size takes a `sycl::item` instead of `sycl::nd_item`
+    config = ps.CreateKernelConfig(target=ps.Target.SYCL)
+    khandle = sfg.kernels.create(asm, "kernel", config)
+
+    cgh = sfg.sycl_handler("handler")
+    rang = sfg.sycl_range(2, "range")
+
+    with pytest.raises(SfgException):
+        cgh.parallel_for(rang, (16, 16))(sfg.call(khandle))
+
+    with pytest.raises(ValueError):
+        cgh.parallel_for(rang, (16, 16), reqd_work_group_size=(8, 8))
+
+    with pytest.raises(ValueError):
+        cgh.parallel_for(rang, reqd_work_group_size=(8, 8))
+
+
+def test_queue_parallel_for_usm(sfg):
+    sfg = sycl.SyclComposer(sfg)
+    f, g = ps.fields("f, g: double[2D]")
+    asm = ps.Assignment(f.center(), g.center())
+
+    config = ps.CreateKernelConfig(target=ps.Target.SYCL)
+    khandle = sfg.kernels.create(asm, "kernel", config)
+
+    queue = sfg.sycl_queue("queue")
+    rang = sfg.sycl_range(2, "range")
+    e_in = sfg.sycl_event("e_in")
+    e_out = sfg.sycl_event("e_out")
+
+    f_ptr = sycl.usm_pointer.from_field(f)
+    g_ptr = sycl.usm_pointer.from_field(g)
+
+    invoke = queue.parallel_for(rang, depends_on=[e_in], event=e_out)(
+        sfg.map_field(f, f_ptr),
+        sfg.map_field(g, g_ptr),
+        sfg.call(khandle),
+    )
+
+    assert invoke.defines == {asvar(e_out)}
+    assert asvar(e_in) in invoke.depends
+
+    code = invoke.get_code(sfg.context.codestyle)
+    assert code.startswith("sycl::event e_out = queue.parallel_for(range, e_in, [=]")
+
+    result = CallTreePostProcessing()(make_sequence(invoke))
+    param_names = {p.name for p in result.function_params}
+    assert {"queue", "range", "e_in", "f", "g"} <= param_names
+    assert "e_out" not in param_names
+
+
+def test_handler_rejects_events(sfg):
+    sfg = sycl.SyclComposer(sfg)
+    cgh = sfg.sycl_handler("handler")
+    rang = sfg.sycl_range(2, "range")
+
+    with pytest.raises(TypeError):
+        cgh.parallel_for(rang, depends_on=[sfg.sycl_event("e")])
+
+
+def test_submit_kernels_event_dependencies(sfg):
+    sfg = sycl.SyclComposer(sfg)
+    f, g, h = ps.fields("f, g, h: double[2D]")
+
+    config = ps.CreateKernelConfig(target=ps.Target.SYCL)
+    #   k1 and k2 only share a read-only field and are therefore independent
+    k1 = sfg.kernels.create(ps.Assignment(f.center(), g.center()), "k1", config)
+    k2 = sfg.kernels.create(ps.Assignment(h.center(), 2 * g.center()), "k2", config)
+    #   k3 overwrites g, which k1 and k2 read, and reads their outputs
+    k3 = sfg.kernels.create(
+        ps.Assignment(g.center(), f.center() + h.center()), "k3", config
+    )
+    #   k4 depends on k1 only through k3, so only the latter dependency is explicit
+    k4 = sfg.kernels.create(ps.Assignment(f.center(), g.center()), "k4", config)
+
+    queue = sfg.sycl_queue("queue")
+    rang = sfg.sycl_range(2, "range")
+    start = sfg.sycl_event("start")
+
+    seq = sfg.sycl_submit_kernels(
+        queue, [k1, k2, k3, k4], rang, depends_on=[start]
+    )
+    code = seq.get_code(sfg.context.codestyle)
+
+    assert "sycl::event __k1_done_0 = queue.parallel_for(range, start, [=]" in code
+    assert "sycl::event __k2_done_1 = queue.parallel_for(range, start, [=]" in code
+    assert (
+        "sycl::event __k3_done_2 = queue.parallel_for(range, { __k1_done_0, __k2_done_1 }, [=]"
+        in code
+    )
+    assert "sycl::event __k4_done_3 = queue.parallel_for(range, __k3_done_2, [=]" in code
+    assert "sycl::event::wait({ __k4_done_3 });" in code
+
+    with pytest.raises(ValueError):
+        sfg.sycl_submit_kernels(queue, [k1])
@@ -18,6 +18,9 @@ def test_defaults():
     assert cfg.clang_format.get_option("binary") == "clang-format"
     assert cfg.clang_format.get_option("code_style") == "file"
     assert cfg.get_option("outer_namespace") is GLOBAL_NAMESPACE
+    assert cfg.profiling.get_option("enable") is False
+    assert cfg.profiling.get_option("gpu_ranges") is False
+    assert cfg.get_option("kernel_cache") is None
 
     cfg.extensions.impl = ".cu"
     assert cfg.extensions.get_option("impl") == "cu"
@@ -107,6 +110,19 @@ def test_from_commandline(sample_config_module):
 
     assert cfg.header_only is False
 
+    args = parser.parse_args(
+        ["--sfg-kernel-cache", ".kernel-cache"]
+    )
+    cli_args = CommandLineParameters(args)
+    cfg = cli_args.get_config()
+
+    assert cfg.kernel_cache == Path(".kernel-cache")
+    assert not cli_args.profile
+
+    args = parser.parse_args(["--sfg-profile"])
+    cli_args = CommandLineParameters(args)
+    assert cli_args.profile
+
     args = parser.parse_args(
         ["--sfg-output-dir", "gen_sources", "--sfg-config-module", sample_config_module]
     )
@@ -0,0 +1,56 @@
+from pystencilssfg.generator_profile import (
+    GeneratorProfile,
+    activate_profile,
+    aggregate_reports,
+    profile_phase,
+)
+
+
+def test_nested_phases():
+    profile = GeneratorProfile("script.py")
+    profile.start()
+    activate_profile(profile)
+
+    try:
+        with profile_phase("outer", "a"):
+            with profile_phase("inner", "b"):
+                buf = bytearray(1 << 20)
+            del buf
+    finally:
+        activate_profile(None)
+
+    profile.stop()
+    report = profile.report()
+
+    inner, outer = report["phases"]
+    assert (inner["phase"], inner["label"]) == ("inner", "b")
+    assert (outer["phase"], outer["label"]) == ("outer", "a")
+
+    assert outer["seconds"] >= inner["seconds"]
+    assert outer["self_seconds"] <= outer["seconds"] - inner["seconds"] + 1e-9
+    assert inner["peak_memory_bytes"] >= 1 << 20
+    assert outer["peak_memory_bytes"] >= inner["peak_memory_bytes"]
+    assert report["total"]["peak_memory_bytes"] >= outer["peak_memory_bytes"]
+
+    assert report["summary"]["inner"]["count"] == 1
+
+
+def test_inactive_profile():
+    with profile_phase("ignored"):
+        pass
+
+
+def test_aggregate_reports():
+    reports = []
+    for script in ("a.py", "b.py"):
+        profile = GeneratorProfile(script)
+        profile.start()
+        for _ in range(2):
+            with profile.phase("kernels.create"):
+                pass
+        profile.stop()
+        reports.append(profile.report())
+
+    aggregated = aggregate_reports(reports)
+    assert {s["script"] for s in aggregated["scripts"]} == {"a.py", "b.py"}
+    assert aggregated["summary"]["kernels.create"]["count"] == 4
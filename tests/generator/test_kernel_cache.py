@@ -0,0 +1,71 @@
+import pystencils as ps
+from pystencils.types import PsStructType
+
+from pystencilssfg.kernel_cache import KernelCache
+
+
+def make_assignments():
+    f, g = ps.fields("f, g: double[2D]")
+    return ps.AssignmentCollection([ps.Assignment(f(0), 2 * g[1, 0] + g[-1, 0])])
+
+
+def test_kernel_cache_roundtrip(tmp_path):
+    cfg = ps.CreateKernelConfig(function_name="cached")
+
+    cache = KernelCache(tmp_path)
+    kernel = cache.create_kernel(make_assignments(), cfg)
+    assert (cache.hits, cache.misses) == (0, 1)
+    assert len(list(tmp_path.glob("*.pickle"))) == 1
+
+    #   A fresh cache on the same directory, as in a subsequent generator run
+    cache2 = KernelCache(tmp_path)
+    cached_kernel = cache2.create_kernel(make_assignments(), cfg)
+    assert (cache2.hits, cache2.misses) == (1, 0)
+
+    assert cached_kernel.name == kernel.name == "cached"
+    assert [p.name for p in cached_kernel.parameters] == [
+        p.name for p in kernel.parameters
+    ]
+
+
+def test_kernel_cache_key():
+    cache = KernelCache(".")
+
+    cfg = ps.CreateKernelConfig(function_name="kernel")
+    key = cache.key(make_assignments(), cfg)
+    assert key is not None
+    assert cache.key(make_assignments(), cfg.copy()) == key
+
+    cfg_renamed = cfg.copy()
+    cfg_renamed.function_name = "other"
+    assert cache.key(make_assignments(), cfg_renamed) != key
+
+    cfg_float = cfg.copy()
+    cfg_float.default_dtype = "float32"
+    assert cache.key(make_assignments(), cfg_float) != key
+
+    f, g = ps.fields("f, g: float[2D]")
+    other_asms = ps.AssignmentCollection([ps.Assignment(f(0), 2 * g[1, 0] + g[-1, 0])])
+    assert cache.key(other_asms, cfg) != key
+
+
+def test_kernel_cache_key_index_structs():
+    cache = KernelCache(".")
+
+    def make_index_kernel(members):
+        f = ps.fields("f: double[1D]")
+        idx = ps.Field.create_generic(
+            "idx",
+            1,
+            dtype=PsStructType(members, name="Cell"),
+            field_type=ps.FieldType.INDEXED,
+        )
+        asms = ps.AssignmentCollection([ps.Assignment(f.center(), idx("value"))])
+        return asms, ps.CreateKernelConfig(index_field=idx)
+
+    key = cache.key(*make_index_kernel([("x", "int32"), ("value", "double")]))
+    assert key is not None
+
+    #   Structs of the same name, but with different members, must not share cache entries
+    other_key = cache.key(*make_index_kernel([("x", "int64"), ("value", "double")]))
+    assert other_key != key
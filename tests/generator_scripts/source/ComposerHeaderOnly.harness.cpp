@@ -24,6 +24,31 @@ int main(void) {
 
         std::vector< int64_t > expected { 3, 6, 9, 12, 15, 18 };
         assert ( arr == expected );
+
+        ker.setC( 2 );
+        ker( arr );
+
+        std::vector< int64_t > expected_twice { 6, 12, 18, 24, 30, 36 };
+        assert ( arr == expected_twice );
+    }
+
+    {
+        std::vector< int64_t > arr { 1, 2, 3, 4, 5, 6 };
+        BoundScaleKernel ker { arr };
+
+        ker( 2 );
+        ker( 3 );
+
+        std::vector< int64_t > expected { 6, 12, 18, 24, 30, 36 };
+        assert ( arr == expected );
+
+        std::vector< int64_t > other { 1, 2, 3 };
+        ker.rebind( other );
+        ker( 5 );
+
+        std::vector< int64_t > expected_other { 5, 10, 15 };
+        assert ( other == expected_other );
+        assert ( arr == expected );
     }
 
     return 0;
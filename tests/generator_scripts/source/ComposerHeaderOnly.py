@@ -40,6 +40,16 @@ with SourceFileGenerator(cfg) as sfg:
                 sfg.map_field(arr, vec),
                 sfg.set_param(c, "this->c"),
                 sfg.call(khandle)
+            ),
+            #   Parameter named like a member variable
+            sfg.method("setC")(
+                sfg.expr("this->{0} = {0};", c)
             )
         )
     )
+
+    #   Persistent kernel binding
+
+    sfg.bound_kernel("BoundScaleKernel", khandle)(
+        sfg.map_field(arr, vec)
+    )
@@ -3,9 +3,12 @@
 #include <cuda_runtime.h>
 
 #include <experimental/mdspan>
+#include <algorithm>
 #include <random>
 #include <iostream>
 #include <functional>
+#include <stdexcept>
+#include <vector>
 
 #undef NDEBUG
 #include <cassert>
@@ -80,6 +83,14 @@ int main(void)
         gen::linear3d_automatic::scaleKernel(dst, src, stream);
         checkCudaError(cudaStreamSynchronize(stream)); });
 
+    check([&]()
+          {
+        /* Linear3D Occupancy-Based */
+        cudaStream_t stream;
+        checkCudaError(cudaStreamCreate(&stream));
+        gen::linear3d_occupancy::scaleKernel(dst, src, stream);
+        checkCudaError(cudaStreamSynchronize(stream)); });
+
     check([&]()
           {
         /* Blockwise4D Automatic */
@@ -109,6 +120,82 @@ int main(void)
         gen::blockwise4d_manual::scaleKernel(blockSize, dst, gridSize, src, stream);
         checkCudaError(cudaStreamSynchronize(stream)); });
 
+    cudaStream_t graphStream;
+    checkCudaError(cudaStreamCreate(&graphStream));
+
+    for (int i = 0; i < 4; ++i)
+    {
+        check([&]()
+              {
+            /* Graph Capture and Replay; changing the block size forces a recapture */
+            dim3 blockSize = (i < 2) ? dim3{64, 8, 1} : dim3{32, 4, 2};
+            gen::graph::scaleKernel(blockSize, dst, src, graphStream);
+            checkCudaError(cudaStreamSynchronize(graphStream)); });
+    }
+
+    {
+        /* Persistent Bound Kernel */
+        dim3 blockSize{64, 8, 1};
+        cudaStream_t stream;
+        checkCudaError(cudaStreamCreate(&stream));
+
+        gen::bound::ScaleKernel scale{blockSize, dst, src};
+
+        for (int i = 0; i < 3; ++i)
+        {
+            check([&]()
+                  {
+                scale(stream);
+                checkCudaError(cudaStreamSynchronize(stream)); });
+        }
+
+        scale.rebind(blockSize, dst, src);
+        check([&]()
+              {
+            scale(stream);
+            checkCudaError(cudaStreamSynchronize(stream)); });
+    }
+
+    {
+        /* Asynchronous Transfers from and to Pinned Host Memory */
+        using pinned_vector = std::vector<double, sfg_gpu::CudaPinnedAllocator<double>>;
+        pinned_vector src_host(items);
+        pinned_vector dst_host(items);
+
+        dim3 blockSize{64, 8, 1};
+        cudaStream_t stream;
+        checkCudaError(cudaStreamCreate(&stream));
+
+        check([&]()
+              {
+            std::copy(data_src, data_src + items, src_host.begin());
+            gen::transfers::scaleKernel(blockSize, dst, dst_host, src, src_host, stream);
+            checkCudaError(cudaStreamSynchronize(stream));
+            std::copy(dst_host.begin(), dst_host.end(), data_dst); });
+
+        /* Host buffers of the wrong size are rejected */
+        pinned_vector too_small(items / 2);
+        bool rejected = false;
+        try
+        {
+            gen::transfers::scaleKernel(blockSize, dst, dst_host, src, too_small, stream);
+        }
+        catch (const std::invalid_argument &)
+        {
+            rejected = true;
+        }
+        assert(rejected);
+    }
+
+    check([&]()
+          {
+        /* Managed Memory Prefetching */
+        dim3 blockSize{64, 8, 1};
+        cudaStream_t stream;
+        checkCudaError(cudaStreamCreate(&stream));
+        gen::prefetch::scaleKernel(blockSize, dst, src, stream);
+        checkCudaError(cudaStreamSynchronize(stream)); });
+
     checkCudaError(cudaFree(data_src));
     checkCudaError(cudaFree(data_dst));
 
@@ -50,6 +50,21 @@ with SourceFileGenerator() as sfg:
             sfg.gpu_invoke(khandle, stream=stream),
         )
 
+    with sfg.namespace("linear3d_occupancy"):
+        cfg = base_config.copy()
+        cfg.gpu.indexing_scheme = "linear3d"
+        khandle = sfg.kernels.create(asm, "scale", cfg)
+
+        sfg.function("scaleKernel")(
+            sfg.map_field(
+                src, std.mdspan.from_field(src, ref=True, layout_policy="layout_right")
+            ),
+            sfg.map_field(
+                dst, std.mdspan.from_field(dst, ref=True, layout_policy="layout_right")
+            ),
+            sfg.gpu_invoke(khandle, block_size_from_occupancy=True, stream=stream),
+        )
+
     with sfg.namespace("blockwise4d"):
         cfg = base_config.copy()
         cfg.gpu.indexing_scheme = "blockwise4d"
@@ -100,3 +115,131 @@ with SourceFileGenerator() as sfg:
                 khandle, block_size=block_size, grid_size=grid_size, stream=stream
             ),
         )
+
+    with sfg.namespace("graph"):
+        cfg = base_config.copy()
+        cfg.gpu.indexing_scheme = "linear3d"
+        khandle = sfg.kernels.create(asm, "scale", cfg)
+
+        sfg.function("scaleKernel")(
+            sfg.map_field(
+                src, std.mdspan.from_field(src, ref=True, layout_policy="layout_right")
+            ),
+            sfg.map_field(
+                dst, std.mdspan.from_field(dst, ref=True, layout_policy="layout_right")
+            ),
+            sfg.gpu_graph(stream)(
+                sfg.gpu_invoke(khandle, stream=stream),
+                sfg.gpu_invoke(khandle, block_size=block_size, stream=stream),
+            ),
+        )
+
+    with sfg.namespace("split"):
+        cfg = base_config.copy()
+        cfg.gpu.indexing_scheme = "linear3d"
+        split = sfg.kernels.create_split(asm, "scale", boundary_width=2, config=cfg)
+
+        interior_stream = cuda.stream_t().var("interiorStream")
+        boundary_stream = cuda.stream_t().var("boundaryStream")
+        boundary_done = cuda.event_t().var("boundaryDone")
+
+        sfg.function("scaleKernel")(
+            sfg.map_field(
+                src, std.mdspan.from_field(src, ref=True, layout_policy="layout_right")
+            ),
+            sfg.map_field(
+                dst, std.mdspan.from_field(dst, ref=True, layout_policy="layout_right")
+            ),
+            sfg.gpu_invoke_split(
+                split,
+                interior_stream=interior_stream,
+                boundary_stream=boundary_stream,
+                boundary_event=boundary_done,
+                block_size=block_size,
+            ),
+        )
+
+    with sfg.namespace("split_manual"):
+        cfg = base_config.copy()
+        cfg.gpu.indexing_scheme = "linear3d"
+        cfg.gpu.manual_launch_grid = True
+        split = sfg.kernels.create_split(asm, "scale", boundary_width=2, config=cfg)
+
+        sfg.function("scaleKernel")(
+            sfg.map_field(
+                src, std.mdspan.from_field(src, ref=True, layout_policy="layout_right")
+            ),
+            sfg.map_field(
+                dst, std.mdspan.from_field(dst, ref=True, layout_policy="layout_right")
+            ),
+            sfg.gpu_invoke_split(
+                split,
+                interior_stream=interior_stream,
+                boundary_stream=boundary_stream,
+                boundary_event=boundary_done,
+                block_size=block_size,
+            ),
+        )
+
+    with sfg.namespace("int32"):
+        cfg = base_config.copy()
+        cfg.gpu.indexing_scheme = "linear3d"
+        khandle = sfg.kernels.create(asm, "scale", cfg, int32_indexing=True)
+
+        sfg.function("scaleKernel")(
+            sfg.map_field(
+                src, std.mdspan.from_field(src, ref=True, layout_policy="layout_right")
+            ),
+            sfg.map_field(
+                dst, std.mdspan.from_field(dst, ref=True, layout_policy="layout_right")
+            ),
+            sfg.gpu_invoke(khandle, block_size=block_size, stream=stream),
+        )
+
+    with sfg.namespace("bound"):
+        cfg = base_config.copy()
+        cfg.gpu.indexing_scheme = "linear3d"
+        khandle = sfg.kernels.create(asm, "scale", cfg)
+
+        sfg.bound_kernel("ScaleKernel", khandle, block_size=block_size, stream=stream)(
+            sfg.map_field(
+                src, std.mdspan.from_field(src, ref=True, layout_policy="layout_right")
+            ),
+            sfg.map_field(
+                dst, std.mdspan.from_field(dst, ref=True, layout_policy="layout_right")
+            ),
+        )
+
+    with sfg.namespace("transfers"):
+        cfg = base_config.copy()
+        cfg.gpu.indexing_scheme = "linear3d"
+        khandle = sfg.kernels.create(asm, "scale", cfg)
+
+        src_dev = std.mdspan.from_field(src, ref=True, layout_policy="layout_right")
+        dst_dev = std.mdspan.from_field(dst, ref=True, layout_policy="layout_right")
+        src_host = sfg.gpu_pinned_vector("double", ref=True, const=True).var("src_host")
+        dst_host = sfg.gpu_pinned_vector("double", ref=True).var("dst_host")
+
+        sfg.function("scaleKernel")(
+            sfg.map_field(src, src_dev),
+            sfg.map_field(dst, dst_dev),
+            sfg.gpu_upload(src, src_host, src_dev, stream=stream),
+            sfg.gpu_invoke(khandle, block_size=block_size, stream=stream),
+            sfg.gpu_download(dst, dst_dev, dst_host, stream=stream),
+        )
+
+    with sfg.namespace("prefetch"):
+        cfg = base_config.copy()
+        cfg.gpu.indexing_scheme = "linear3d"
+        khandle = sfg.kernels.create(asm, "scale", cfg)
+
+        src_dev = std.mdspan.from_field(src, ref=True, layout_policy="layout_right")
+        dst_dev = std.mdspan.from_field(dst, ref=True, layout_policy="layout_right")
+
+        sfg.function("scaleKernel")(
+            sfg.map_field(src, src_dev),
+            sfg.map_field(dst, dst_dev),
+            sfg.gpu_prefetch(src, src_dev, stream=stream),
+            sfg.gpu_prefetch(dst, dst_dev, stream=stream),
+            sfg.gpu_invoke(khandle, block_size=block_size, stream=stream),
+        )
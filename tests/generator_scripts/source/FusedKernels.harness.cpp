@@ -0,0 +1,41 @@
+#include "FusedKernels.hpp"
+
+#include <cassert>
+#include <span>
+#include <vector>
+
+int main(void)
+{
+    constexpr size_t N { 64 };
+
+    std::vector<double> src(N), tmp(N, 0.0), dst(N, 0.0), out(N, 0.0);
+    for (size_t i = 0; i < N; ++i)
+    {
+        src[i] = double(i);
+    }
+
+    FusedKernels::gen::fusedChain(src, tmp, dst, out);
+
+    for (size_t i = 0; i < N; ++i)
+    {
+        assert(tmp[i] == 2.0 * double(i));
+        assert(dst[i] == 2.0 * double(i) + 1.0);
+        assert(out[i] == 3.0 * double(i));
+    }
+
+    FusedKernels::gen::fusedWithParam(0.5, src, dst, out);
+
+    for (size_t i = 0; i < N; ++i)
+    {
+        assert(dst[i] == 4.0 * double(i));
+        assert(out[i] == double(i) + 0.5);
+    }
+
+    FusedKernels::gen::fusedOverwrite(out, src, tmp);
+
+    for (size_t i = 0; i < N; ++i)
+    {
+        assert(tmp[i] == 2.0 * (double(i) + 1.0));
+        assert(out[i] == 2.0 * (double(i) + 1.0));
+    }
+}
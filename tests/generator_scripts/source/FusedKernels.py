@@ -0,0 +1,69 @@
+import pystencils as ps
+import sympy as sp
+
+from pystencilssfg import SourceFileGenerator
+from pystencilssfg.lang.cpp import std
+
+
+with SourceFileGenerator() as sfg:
+    sfg.namespace("FusedKernels::gen")
+
+    src, tmp, dst, out = ps.fields("src, tmp, dst, out: double[1D]")
+    rho = sp.Symbol("rho")
+
+    scale = sfg.kernels.create(ps.Assignment(tmp[0], 2 * src[0]), "scale")
+
+    shift = ps.AssignmentCollection(
+        [ps.Assignment(dst[0], rho)],
+        subexpressions=[ps.Assignment(rho, tmp[0] + 1)],
+    )
+
+    triple = ps.AssignmentCollection(
+        [ps.Assignment(out[0], rho)],
+        subexpressions=[ps.Assignment(rho, 3 * src[0])],
+    )
+
+    fused = sfg.kernels.fuse([scale, shift, triple], "fused")
+
+    sfg.function("fusedChain")(
+        sfg.map_field(src, std.span.from_field(src)),
+        sfg.map_field(tmp, std.span.from_field(tmp)),
+        sfg.map_field(dst, std.span.from_field(dst)),
+        sfg.map_field(out, std.span.from_field(out)),
+        sfg.call(fused),
+    )
+
+    #   The subexpression `c` of the first part must not capture the free symbol `c` of the second
+    c = sp.Symbol("c")
+    quadruple = ps.AssignmentCollection(
+        [ps.Assignment(dst[0], c)],
+        subexpressions=[ps.Assignment(c, 4 * src[0])],
+    )
+    add_c = ps.Assignment(out[0], src[0] + c)
+
+    fused_param = sfg.kernels.fuse([quadruple, add_c], "fused_param")
+
+    sfg.function("fusedWithParam")(
+        sfg.map_field(src, std.span.from_field(src)),
+        sfg.map_field(dst, std.span.from_field(dst)),
+        sfg.map_field(out, std.span.from_field(out)),
+        sfg.call(fused_param),
+    )
+
+    #   Several parts overwriting the same field each forward their value to the next
+    fused_overwrite = sfg.kernels.fuse(
+        [
+            ps.Assignment(tmp[0], src[0]),
+            ps.Assignment(tmp[0], tmp[0] + 1),
+            ps.Assignment(tmp[0], 2 * tmp[0]),
+            ps.Assignment(out[0], tmp[0]),
+        ],
+        "fused_overwrite",
+    )
+
+    sfg.function("fusedOverwrite")(
+        sfg.map_field(src, std.span.from_field(src)),
+        sfg.map_field(tmp, std.span.from_field(tmp)),
+        sfg.map_field(out, std.span.from_field(out)),
+        sfg.call(fused_overwrite),
+    )
@@ -0,0 +1,20 @@
+from pystencils import fields, kernel
+
+from pystencilssfg import SourceFileGenerator
+
+with SourceFileGenerator() as sfg:
+    sfg.namespace("gen")
+
+    src, dst = fields("src, dst: double[2D]")
+
+    @kernel
+    def copy():
+        dst[0, 0] @= src[0, 0]
+
+    @kernel
+    def average():
+        dst[0, 0] @= (src[1, 0] + src[-1, 0] + src[0, 1] + src[0, -1]) / 4
+
+    for name, ker in (("copy", copy), ("average", average)):
+        khandle = sfg.kernels.create(ker, name)
+        sfg.function(khandle.name)(sfg.call(khandle))
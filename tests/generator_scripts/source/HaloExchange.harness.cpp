@@ -0,0 +1,102 @@
+#include "HaloExchange.hpp"
+
+#include <experimental/mdspan>
+#include <array>
+#include <cassert>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace stdex = std::experimental;
+
+using shape_type = stdex::extents< int64_t, std::dynamic_extent, std::dynamic_extent, std::dynamic_extent, 6 >;
+
+constexpr shape_type field_shape { 10l, 9l, 8l };
+constexpr int64_t gls { 2 };
+
+double encode(int64_t x, int64_t y, int64_t z, int64_t i)
+{
+    return double(((x * 100 + y) * 100 + z) * 10 + i);
+}
+
+/**
+ * Simulates the exchange between two neighboring processes:
+ * The eastward halo of `west` is packed and unpacked into the western ghost layers of `east`.
+ */
+template <typename PackEast, typename UnpackWest, typename PdfField>
+void test_exchange(PackEast packEast, UnpackWest unpackWest, PdfField &west, PdfField &east)
+{
+    const int64_t nx { field_shape.extent(0) };
+    const int64_t ny { field_shape.extent(1) };
+    const int64_t nz { field_shape.extent(2) };
+
+    for (int64_t z = 0; z < nz; ++z)
+        for (int64_t y = 0; y < ny; ++y)
+            for (int64_t x = 0; x < nx; ++x)
+                for (int64_t i = 0; i < 6; ++i)
+                {
+                    west(x, y, z, i) = encode(x, y, z, i);
+                    east(x, y, z, i) = -1.0;
+                }
+
+    //  Only the single eastward population crosses the face
+    std::vector<double> buffer_data(gls * (ny - 2 * gls) * (nz - 2 * gls), 0.0);
+    std::span<double> buffer{buffer_data};
+
+    packEast(west, buffer);
+    unpackWest(east, buffer);
+
+    for (int64_t z = 0; z < nz; ++z)
+        for (int64_t y = 0; y < ny; ++y)
+            for (int64_t x = 0; x < nx; ++x)
+                for (int64_t i = 0; i < 6; ++i)
+                {
+                    const bool inHalo = x < gls && y >= gls && y < ny - gls && z >= gls && z < nz - gls;
+                    if (inHalo && gen::STENCIL[i][0] == 1)
+                    {
+                        assert((east(x, y, z, i) == encode(x + nx - 2 * gls, y, z, i)));
+                    }
+                    else
+                    {
+                        assert((east(x, y, z, i) == -1.0));
+                    }
+                }
+}
+
+int main(void)
+{
+    constexpr size_t num_items { (size_t) field_shape.extent(0) * field_shape.extent(1) * field_shape.extent(2) * field_shape.extent(3) };
+
+    auto west_data = std::make_unique< double [] >( num_items );
+    auto east_data = std::make_unique< double [] >( num_items );
+
+    // Structure-of-Arrays
+    {
+        gen::field_fzyx west { west_data.get(), field_shape };
+        gen::field_fzyx east { east_data.get(), field_shape };
+        test_exchange(gen::packEast_fzyx, gen::unpackWest_fzyx, west, east);
+    }
+
+    // Array-of-Structures
+    {
+        std::array< uint64_t, 4 > strides_xyzf {
+            /* stride(x) */ field_shape.extent(3),
+            /* stride(y) */ field_shape.extent(3) * field_shape.extent(0),
+            /* stride(z) */ field_shape.extent(3) * field_shape.extent(0) * field_shape.extent(1),
+            /* stride(f) */ 1
+        };
+
+        gen::field_zyxf::mapping_type zyxf_mapping { field_shape, strides_xyzf };
+
+        gen::field_zyxf west { west_data.get(), zyxf_mapping };
+        gen::field_zyxf east { east_data.get(), zyxf_mapping };
+        test_exchange(gen::packEast_zyxf, gen::unpackWest_zyxf, west, east);
+    }
+
+    // C Row-Major
+    {
+        gen::field_c west { west_data.get(), field_shape };
+        gen::field_c east { east_data.get(), field_shape };
+        test_exchange(gen::packEast_c, gen::unpackWest_c, west, east);
+    }
+}
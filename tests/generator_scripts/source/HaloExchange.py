@@ -0,0 +1,56 @@
+import pystencils as ps
+from pystencilssfg import SourceFileGenerator, SfgComposer
+from pystencilssfg.lang.cpp import std
+from pystencilssfg.lang import strip_ptr_ref
+
+std.mdspan.configure(namespace="std::experimental", header="<experimental/mdspan>")
+
+stencil = ((-1, 0, 0), (1, 0, 0), (0, -1, 0), (0, 1, 0), (0, 0, 1), (0, 0, -1))
+directions = ((1, 0, 0), (-1, 0, 0))
+
+
+def halo_exchange(sfg: SfgComposer, field_layout: str, layout_policy: str):
+    f = ps.fields("f(6): double[3D]", layout=field_layout)
+    f_mdspan = std.mdspan.from_field(
+        f, layout_policy=layout_policy, extents_type="int64", ref=True
+    )
+
+    halo = sfg.kernels.create_halo_kernels(
+        f, directions, f"halo_{field_layout}", ghost_layers=2, stencil=stencil
+    )
+
+    sfg.code(f"using field_{field_layout} = {strip_ptr_ref(f_mdspan.get_dtype())};")
+
+    for direction, kernels in halo.items():
+        buffer = std.span.from_field(kernels.buffer, ref=True)
+        suffix = "East" if direction[0] > 0 else "West"
+
+        sfg.function(f"pack{suffix}_{field_layout}")(
+            sfg.map_field(f, f_mdspan),
+            sfg.map_field(kernels.buffer, buffer),
+            sfg.call(kernels.pack),
+        )
+
+        sfg.function(f"unpack{suffix}_{field_layout}")(
+            sfg.map_field(f, f_mdspan),
+            sfg.map_field(kernels.buffer, buffer),
+            sfg.call(kernels.unpack),
+        )
+
+
+with SourceFileGenerator() as sfg:
+    sfg.namespace("gen")
+    sfg.include("<array>")
+
+    stencil_code = (
+        "{{"
+        + ", ".join("{" + ", ".join(str(ci) for ci in c) + "}" for c in stencil)
+        + "}}"
+    )
+    sfg.code(
+        f"constexpr std::array< std::array< int64_t, 3 >, 6 > STENCIL = {stencil_code};"
+    )
+
+    halo_exchange(sfg, "fzyx", "layout_left")
+    halo_exchange(sfg, "c", "layout_right")
+    halo_exchange(sfg, "zyxf", "layout_stride")
@@ -80,6 +80,14 @@ int main(void)
         gen::linear3d_automatic::scaleKernel(dst, src, stream);
         checkHipError(hipStreamSynchronize(stream)); });
 
+    check([&]()
+          {
+        /* Linear3D Occupancy-Based */
+        hipStream_t stream;
+        checkHipError(hipStreamCreate(&stream));
+        gen::linear3d_occupancy::scaleKernel(dst, src, stream);
+        checkHipError(hipStreamSynchronize(stream)); });
+
     check([&]()
           {
         /* Blockwise4D Automatic */
@@ -109,6 +117,19 @@ int main(void)
         gen::blockwise4d_manual::scaleKernel(blockSize, dst, gridSize, src, stream);
         checkHipError(hipStreamSynchronize(stream)); });
 
+    hipStream_t graphStream;
+    checkHipError(hipStreamCreate(&graphStream));
+
+    for (int i = 0; i < 4; ++i)
+    {
+        check([&]()
+              {
+            /* Graph Capture and Replay; changing the block size forces a recapture */
+            dim3 blockSize = (i < 2) ? dim3{64, 8, 1} : dim3{32, 4, 2};
+            gen::graph::scaleKernel(blockSize, dst, src, graphStream);
+            checkHipError(hipStreamSynchronize(graphStream)); });
+    }
+
     checkHipError(hipFree(data_src));
     checkHipError(hipFree(data_dst));
 
@@ -50,6 +50,21 @@ with SourceFileGenerator() as sfg:
             sfg.gpu_invoke(khandle, stream=stream),
         )
 
+    with sfg.namespace("linear3d_occupancy"):
+        cfg = base_config.copy()
+        cfg.gpu.indexing_scheme = "linear3d"
+        khandle = sfg.kernels.create(asm, "scale", cfg)
+
+        sfg.function("scaleKernel")(
+            sfg.map_field(
+                src, std.mdspan.from_field(src, ref=True, layout_policy="layout_right")
+            ),
+            sfg.map_field(
+                dst, std.mdspan.from_field(dst, ref=True, layout_policy="layout_right")
+            ),
+            sfg.gpu_invoke(khandle, block_size_from_occupancy=True, stream=stream),
+        )
+
     with sfg.namespace("blockwise4d"):
         cfg = base_config.copy()
         cfg.gpu.indexing_scheme = "blockwise4d"
@@ -100,3 +115,21 @@ with SourceFileGenerator() as sfg:
                 khandle, block_size=block_size, grid_size=grid_size, stream=stream
             ),
         )
+
+    with sfg.namespace("graph"):
+        cfg = base_config.copy()
+        cfg.gpu.indexing_scheme = "linear3d"
+        khandle = sfg.kernels.create(asm, "scale", cfg)
+
+        sfg.function("scaleKernel")(
+            sfg.map_field(
+                src, std.mdspan.from_field(src, ref=True, layout_policy="layout_right")
+            ),
+            sfg.map_field(
+                dst, std.mdspan.from_field(dst, ref=True, layout_policy="layout_right")
+            ),
+            sfg.gpu_graph(stream)(
+                sfg.gpu_invoke(khandle, stream=stream),
+                sfg.gpu_invoke(khandle, block_size=block_size, stream=stream),
+            ),
+        )
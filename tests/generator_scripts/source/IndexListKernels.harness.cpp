@@ -0,0 +1,88 @@
+#include "IndexListKernels.hpp"
+
+#include <experimental/mdspan>
+#include <memory>
+#include <span>
+#include <vector>
+#include <cmath>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#include <cassert>
+#define NDEBUG
+#else
+#include <cassert>
+#endif
+
+namespace stdex = std::experimental;
+
+using field_t = stdex::mdspan<double, stdex::extents<int64_t, std::dynamic_extent, std::dynamic_extent>, stdex::layout_left>;
+
+namespace IndexListKernels
+{
+    constexpr int64_t nx{31};
+    constexpr int64_t ny{23};
+
+    std::vector<gen::CellValue> make_index_list()
+    {
+        std::vector<gen::CellValue> cells;
+        for (int32_t y = 0; y < ny; ++y)
+        {
+            for (int32_t x = 0; x < nx; ++x)
+            {
+                if ((x + nx * y) % 7 == 0)
+                {
+                    cells.emplace_back(x, y, double(x - y));
+                }
+            }
+        }
+        return cells;
+    }
+
+    void check_result(field_t f)
+    {
+        for (int64_t y = 0; y < ny; ++y)
+        {
+            for (int64_t x = 0; x < nx; ++x)
+            {
+                const double desired = ((x + nx * y) % 7 == 0) ? 1.0 + double(x - y) : 1.0;
+                assert(std::abs(f(x, y) - desired) < 1e-12);
+            }
+        }
+    }
+
+    void test_vector()
+    {
+        auto data = std::make_unique<double[]>(nx * ny);
+        field_t f{data.get(), nx, ny};
+        for (int64_t i = 0; i < nx * ny; ++i)
+        {
+            data[i] = 1.0;
+        }
+
+        const std::vector<gen::CellValue> cells{make_index_list()};
+        gen::addToCellsVector(f, cells);
+        check_result(f);
+    }
+
+    void test_span()
+    {
+        auto data = std::make_unique<double[]>(nx * ny);
+        field_t f{data.get(), nx, ny};
+        for (int64_t i = 0; i < nx * ny; ++i)
+        {
+            data[i] = 1.0;
+        }
+
+        std::vector<gen::CellValue> cells{make_index_list()};
+        gen::addToCellsSpan(f, std::span<gen::CellValue>{cells});
+        check_result(f);
+    }
+}
+
+int main(void)
+{
+    IndexListKernels::test_vector();
+    IndexListKernels::test_span();
+    return 0;
+}
@@ -0,0 +1,28 @@
+import pystencils as ps
+
+from pystencilssfg import SourceFileGenerator
+from pystencilssfg.lang.cpp import std
+
+std.mdspan.configure(namespace="std::experimental", header="<experimental/mdspan>")
+
+with SourceFileGenerator() as sfg:
+    sfg.namespace("IndexListKernels::gen")
+
+    f = ps.fields("f: double[2D]", layout="fzyx")
+    idx = sfg.index_field("idx", "CellValue", 2, {"value": "double"})
+
+    asm = ps.Assignment(f.center(), f.center() + idx("value"))
+    cfg = ps.CreateKernelConfig(index_field=idx)
+    khandle = sfg.kernels.create(asm, "add_to_cells", cfg)
+
+    sfg.function("addToCellsVector")(
+        sfg.map_field(idx, std.vector.from_field(idx, const=True)),
+        sfg.map_field(f, std.mdspan.from_field(f, layout_policy="layout_left")),
+        sfg.call(khandle),
+    )
+
+    sfg.function("addToCellsSpan")(
+        sfg.map_field(idx, std.span.from_field(idx)),
+        sfg.map_field(f, std.mdspan.from_field(f, layout_policy="layout_left")),
+        sfg.call(khandle),
+    )
@@ -2,12 +2,108 @@
 
 #include <experimental/mdspan>
 #include <memory>
+#include <random>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#include <cassert>
+#define NDEBUG
+#else
+#include <cassert>
+#endif
 
 namespace stdex = std::experimental;
 
 using field_t = stdex::mdspan<double, stdex::extents<int64_t, std::dynamic_extent, std::dynamic_extent>, stdex::layout_left>;
 using scalar_field_t = stdex::mdspan<double, stdex::extents<int64_t, std::dynamic_extent, std::dynamic_extent, 1>, stdex::layout_left>;
 
+void test_temporal_blocking()
+{
+    constexpr int64_t nx{24};
+    constexpr int64_t ny{53};
+    constexpr int64_t iterations{7};
+
+    std::mt19937 gen{42};
+    std::uniform_real_distribution<double> distrib{-1.0, 1.0};
+
+    auto data_f = std::make_unique<double[]>(nx * ny);
+    scalar_field_t f{data_f.get(), nx, ny};
+
+    auto data_ref_a = std::make_unique<double[]>(nx * ny);
+    auto data_ref_b = std::make_unique<double[]>(nx * ny);
+    auto data_u = std::make_unique<double[]>(nx * ny);
+    auto data_u_tmp = std::make_unique<double[]>(nx * ny);
+
+    for (int64_t i = 0; i < nx * ny; ++i)
+    {
+        data_f[i] = distrib(gen);
+        data_ref_a[i] = data_ref_b[i] = data_u[i] = data_u_tmp[i] = distrib(gen);
+    }
+
+    field_t ref_a{data_ref_a.get(), nx, ny};
+    field_t ref_b{data_ref_b.get(), nx, ny};
+    field_t u{data_u.get(), nx, ny};
+    field_t u_tmp{data_u_tmp.get(), nx, ny};
+
+    double h{1.0 / double(nx - 1)};
+
+    for (int64_t i = 0; i < iterations; ++i)
+    {
+        if (i % 2 == 0)
+            gen::jacobi_smooth(f, h, ref_b, ref_a);
+        else
+            gen::jacobi_smooth(f, h, ref_a, ref_b);
+    }
+
+    gen::jacobi_smooth_blocked(f, h, iterations, u_tmp, u);
+
+    //  After an odd number of sweeps, the result resides in the destination field
+    for (int64_t y = 0; y < ny; ++y)
+        for (int64_t x = 0; x < nx; ++x)
+        {
+            assert(u_tmp(x, y) == ref_b(x, y));
+            assert(u(x, y) == ref_a(x, y));
+        }
+}
+
+void test_static_shapes(int64_t nx, int64_t ny)
+{
+    std::mt19937 gen{7};
+    std::uniform_real_distribution<double> distrib{-1.0, 1.0};
+
+    auto data_f = std::make_unique<double[]>(nx * ny);
+    auto data_u = std::make_unique<double[]>(nx * ny);
+    auto data_ref = std::make_unique<double[]>(nx * ny);
+    auto data_out = std::make_unique<double[]>(nx * ny);
+
+    for (int64_t i = 0; i < nx * ny; ++i)
+    {
+        data_f[i] = distrib(gen);
+        data_u[i] = distrib(gen);
+        data_ref[i] = data_out[i] = 0.0;
+    }
+
+    scalar_field_t f{data_f.get(), nx, ny};
+    field_t u{data_u.get(), nx, ny};
+    field_t ref{data_ref.get(), nx, ny};
+    field_t out{data_out.get(), nx, ny};
+
+    double h{1.0 / double(nx - 1)};
+
+    gen::jacobi_smooth(f, h, ref, u);
+    gen::jacobi_smooth_static(f, h, out, u);
+
+    for (int64_t y = 0; y < ny; ++y)
+        for (int64_t x = 0; x < nx; ++x)
+            assert(out(x, y) == ref(x, y));
+}
+
+using poisson_metadata = gen::kernels::poisson_static_metadata;
+static_assert(poisson_metadata::rank == 2);
+static_assert(poisson_metadata::bytes_loaded == 16);
+static_assert(poisson_metadata::bytes_stored == 8);
+static_assert(poisson_metadata::fields.size() == 3);
+
 int main(void)
 {
     auto data_f = std::make_unique<double[]>(64);
@@ -22,4 +118,13 @@ int main(void)
     double h{1.0 / 7.0};
 
     gen::jacobi_smooth(f, h, u_tmp, u);
+
+    test_temporal_blocking();
+
+    //  Specialized shapes
+    test_static_shapes(16, 16);
+    test_static_shapes(24, 53);
+
+    //  Generic fallback
+    test_static_shapes(17, 9);
 }
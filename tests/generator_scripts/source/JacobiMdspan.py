@@ -27,3 +27,23 @@ with SourceFileGenerator() as sfg:
         sfg.map_field(f, mdspan.from_field(f, layout_policy="layout_left")),
         sfg.call(poisson_kernel),
     )
+
+    n = sfg.var("n", "int64_t")
+
+    sfg.function("jacobi_smooth_blocked")(
+        sfg.map_field(u_src, mdspan.from_field(u_src, layout_policy="layout_left")),
+        sfg.map_field(u_dst, mdspan.from_field(u_dst, layout_policy="layout_left")),
+        sfg.map_field(f, mdspan.from_field(f, layout_policy="layout_left")),
+        sfg.temporal_blocking(poisson_kernel, n, (u_src, u_dst), time_block=4),
+    )
+
+    poisson_static = sfg.kernels.create(
+        poisson_jacobi, "poisson_static", static_shapes=[(16, 16), (24, 53)]
+    )
+
+    sfg.function("jacobi_smooth_static")(
+        sfg.map_field(u_src, mdspan.from_field(u_src, layout_policy="layout_left")),
+        sfg.map_field(u_dst, mdspan.from_field(u_dst, layout_policy="layout_left")),
+        sfg.map_field(f, mdspan.from_field(f, layout_policy="layout_left")),
+        sfg.call(poisson_static),
+    )
@@ -0,0 +1,67 @@
+#include "KernelBenchmarks.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#undef NDEBUG
+#include <cassert>
+
+using benchmark_t = std::function<void(int64_t, int64_t, int64_t, std::ostream &)>;
+
+static const std::vector<benchmark_t> BENCHMARKS{
+    gen::bench_scale_fzyx,
+    gen::bench_scale_zyxf,
+    gen::bench_scale_c,
+    gen::bench_stream_fzyx,
+    gen::bench_stream_zyxf,
+    gen::bench_stream_c,
+    gen::bench_jacobi,
+};
+
+/**
+ * Usage: `a.out --benchmark <n> <repetitions>`
+ * Without arguments, runs each benchmark on a small domain and checks its report.
+ */
+int main(int argc, char **argv)
+{
+    if (argc == 4 && std::string_view{argv[1]} == "--benchmark")
+    {
+        const int64_t n{std::stoll(argv[2])};
+        const int64_t repetitions{std::stoll(argv[3])};
+        for (auto &bench : BENCHMARKS)
+        {
+            bench(n, 2, repetitions, std::cout);
+        }
+        return 0;
+    }
+
+    assert(argc == 1);
+
+    //  Cells inside each kernel's iteration space on an 8^d domain; ghost layers are excluded
+    static const std::vector<std::string_view> CELLS{
+        "512", "512", "512", "216", "216", "216", "36"};
+
+    for (size_t i = 0; i < BENCHMARKS.size(); ++i)
+    {
+        auto &bench = BENCHMARKS[i];
+        std::ostringstream out;
+        bench(8, 1, 2, out);
+
+        const std::string report{out.str()};
+        assert(report.starts_with("{ \"kernel\": \"gen::kernels::"));
+        assert(report.find("\"repetitions\": 2") != std::string::npos);
+        assert(report.find("\"cells\": " + std::string{CELLS[i]} + ",") != std::string::npos);
+        assert(report.find("\"mlups\": ") != std::string::npos);
+        assert(report.find("\"gbytes_per_second\": ") != std::string::npos);
+        assert(report.ends_with("}\n"));
+    }
+
+    static_assert(gen::kernels::scale_fzyx_metadata::bytes_loaded == 48);
+    static_assert(gen::kernels::stream_zyxf_metadata::bytes_stored == 48);
+    static_assert(gen::kernels::jacobi_metadata::rank == 2);
+}
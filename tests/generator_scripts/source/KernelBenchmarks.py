@@ -0,0 +1,53 @@
+import numpy as np
+import sympy as sp
+import pystencils as ps
+
+from pystencilssfg import SourceFileGenerator
+from pystencilssfg.lang import AugExpr, cpptype
+
+stencil = ((-1, 0, 0), (1, 0, 0), (0, -1, 0), (0, 1, 0), (0, 0, 1), (0, 0, -1))
+
+with SourceFileGenerator() as sfg:
+    sfg.namespace("gen")
+
+    n, warmup, repetitions = sfg.vars("n, warmup, repetitions", "int64_t")
+    out = AugExpr(cpptype("std::ostream", "<ostream>")(ref=True)).var("out")
+
+    def benchmark(khandle, shape):
+        sfg.function(f"bench_{khandle.name}").params(n, warmup, repetitions, out)(
+            sfg.benchmark(
+                khandle, shape, repetitions=repetitions, warmup=warmup, out=out
+            )
+        )
+
+    for layout in ("fzyx", "zyxf", "c"):
+        src, dst = ps.fields("src(6), dst(6): double[3D]", layout=layout)
+        alpha = sp.Symbol("alpha")
+
+        scale = sfg.kernels.create(
+            [ps.Assignment(dst(i), alpha * src(i)) for i in range(6)],
+            f"scale_{layout}",
+        )
+        benchmark(scale, (n, n, n))
+
+        stream = sfg.kernels.create(
+            [
+                ps.Assignment(dst.center(i), src[-np.array(d)](i))
+                for i, d in enumerate(stencil)
+            ],
+            f"stream_{layout}",
+        )
+        benchmark(stream, (n, n, n))
+
+    u_src, u_dst, f = ps.fields("u_src, u_dst, f: double[2D]")
+    h = sp.Symbol("h")
+
+    jacobi = sfg.kernels.create(
+        ps.Assignment(
+            u_dst[0, 0],
+            (h**2 * f[0, 0] + u_src[1, 0] + u_src[-1, 0] + u_src[0, 1] + u_src[0, -1])
+            / 4,
+        ),
+        "jacobi",
+    )
+    benchmark(jacobi, (n, n))
@@ -0,0 +1,38 @@
+#include "KernelProfiling.hpp"
+
+#include <string_view>
+#include <vector>
+
+#undef NDEBUG
+#include <cassert>
+
+int main(void)
+{
+    std::vector<double> f(32, 0.0);
+    std::vector<double> g(32, 1.0);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        gen::scaleAndCopy(f, g);
+    }
+    gen::scaleOnly(f, g);
+
+    assert(f[0] == 16.0);
+
+    auto &profiles = sfg_profiling::KernelProfiling::kernel_profiles;
+    assert(profiles.size() == 2);
+
+    for (auto &profile : profiles)
+    {
+        const std::string_view name{profile.name};
+        if (name == "gen::kernels::scale")
+        {
+            assert(profile.calls == 4);
+        }
+        else
+        {
+            assert(name == "gen::kernels::copy");
+            assert(profile.calls == 3);
+        }
+    }
+}
@@ -0,0 +1,28 @@
+import pystencils as ps
+
+from pystencilssfg import SourceFileGenerator, SfgConfig
+from pystencilssfg.lang.cpp import std
+
+cfg = SfgConfig()
+cfg.profiling.enable = True
+
+with SourceFileGenerator(cfg) as sfg:
+    sfg.namespace("gen")
+
+    f, g = ps.fields("f, g: double[1D]")
+
+    scale = sfg.kernels.create(ps.Assignment(f(0), 2 * g(0)), "scale")
+    copy = sfg.kernels.create(ps.Assignment(g(0), f(0)), "copy")
+
+    sfg.function("scaleAndCopy")(
+        sfg.map_field(f, std.vector.from_field(f)),
+        sfg.map_field(g, std.vector.from_field(g)),
+        sfg.call(scale),
+        sfg.call(copy),
+    )
+
+    sfg.function("scaleOnly")(
+        sfg.map_field(f, std.vector.from_field(f)),
+        sfg.map_field(g, std.vector.from_field(g)),
+        sfg.call(scale),
+    )
@@ -0,0 +1,25 @@
+#include "OmpTasks.hpp"
+
+#include <cassert>
+#include <span>
+#include <vector>
+
+int main(void)
+{
+    constexpr size_t N { 1024 };
+
+    std::vector<double> src(N), a(N, 0.0), b(N, 0.0), c(N, 0.0);
+    for (size_t i = 0; i < N; ++i)
+    {
+        src[i] = double(i);
+    }
+
+    OmpTasks::gen::compute(src, a, b, c);
+
+    for (size_t i = 0; i < N; ++i)
+    {
+        assert(a[i] == 2.0 * double(i));
+        assert(b[i] == 3.0 * double(i));
+        assert(c[i] == 5.0 * double(i));
+    }
+}
@@ -0,0 +1,24 @@
+import pystencils as ps
+
+from pystencilssfg import SourceFileGenerator
+from pystencilssfg.lang.cpp import std
+
+
+with SourceFileGenerator() as sfg:
+    sfg.namespace("OmpTasks::gen")
+
+    src, a, b, c = ps.fields("src, a, b, c: double[1D]")
+
+    k_double = sfg.kernels.create(ps.Assignment(a[0], 2 * src[0]), "double_it")
+    k_triple = sfg.kernels.create(ps.Assignment(b[0], 3 * src[0]), "triple_it")
+    k_sum = sfg.kernels.create(ps.Assignment(c[0], a[0] + b[0]), "sum_up")
+
+    sfg.function("compute").omp_tasks()(
+        sfg.map_field(src, std.span.from_field(src)),
+        sfg.map_field(a, std.span.from_field(a)),
+        sfg.map_field(b, std.span.from_field(b)),
+        sfg.map_field(c, std.span.from_field(c)),
+        sfg.call(k_double),
+        sfg.call(k_triple),
+        sfg.call(k_sum),
+    )
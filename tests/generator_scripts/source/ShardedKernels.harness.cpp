@@ -0,0 +1,25 @@
+#include "ShardedKernels.hpp"
+
+#include <vector>
+
+#undef NDEBUG
+#include <cassert>
+
+int main(void){
+    std::vector< double > src(gen::N, 1.0);
+    std::vector< double > dst(gen::N, 0.0);
+
+    gen::scaleBy1(dst.data(), src.data());
+    assert( dst[0] == 1.0 );
+
+    gen::scaleBy2(dst.data(), src.data());
+    assert( dst[0] == 2.0 );
+
+    gen::scaleBy3(dst.data(), src.data());
+    assert( dst[0] == 3.0 );
+
+    gen::scaleBy4(dst.data(), src.data());
+    assert( dst[gen::N - 1] == 4.0 );
+
+    assert( gen::shardCounter == 42 );
+}
@@ -0,0 +1,24 @@
+from pystencils import fields, kernel
+
+from pystencilssfg import SourceFileGenerator
+
+with SourceFileGenerator() as sfg:
+    sfg.namespace("gen")
+
+    N = 16
+    src, dst = fields(f"src, dst: double[{N}]")
+
+    sfg.code(f"constexpr int N = {N};")
+
+    #   Definitions in verbatim implementation code must not be replicated across shards
+    sfg.code("extern int shardCounter;")
+    sfg.code("int shardCounter = 42;", impl=True)
+
+    for i in range(1, 5):
+
+        @kernel
+        def scale():
+            dst[0] @= i * src[0]
+
+        khandle = sfg.kernels.create(scale, f"scale{i}")
+        sfg.function(f"scaleBy{i}")(sfg.call(khandle))
@@ -6,6 +6,9 @@
 #include <random>
 #include <cmath>
 #include <memory>
+#include <array>
+#include <cstdint>
+#include <experimental/mdspan>
 
 #ifdef NDEBUG
 #undef NDEBUG
@@ -47,6 +50,33 @@ namespace StlContainers1D
         }
     }
 
+    void test_aligned_vector_kernel()
+    {
+        std::random_device rd;
+        std::mt19937 gen{ rd() };
+        std::uniform_real_distribution<double> distrib{-1.0, 1.0};
+
+        using aligned_vector = std::vector<double, sfg_std::AlignedAllocator<double, 64>>;
+        aligned_vector src(N);
+        aligned_vector dst(N, 0.0);
+
+        assert( reinterpret_cast<std::uintptr_t>(src.data()) % 64 == 0 );
+        assert( reinterpret_cast<std::uintptr_t>(dst.data()) % 64 == 0 );
+
+        for (size_t i = 0; i < N; ++i)
+        {
+            src[i] = distrib(gen);
+        }
+
+        gen::averageAlignedVector(dst, src);
+
+        for (size_t i = 1; i < N - 1; ++i)
+        {
+            const double desired = one_third * ( src[i - 1] + src[i] + src[i + 1] );
+            assert( std::abs(desired - dst[i]) < 1e-12 );
+        }
+    }
+
     void test_span_kernel()
     {
         std::random_device rd;
@@ -74,12 +104,114 @@ namespace StlContainers1D
         }
     }
 
+    void test_span_fast_path_kernel()
+    {
+        std::random_device rd;
+        std::mt19937 gen{ rd() };
+        std::uniform_real_distribution<double> distrib{-1.0, 1.0};
+
+        auto src_data = std::make_unique< double[] >(N);
+        auto dst_data = std::make_unique< double[] >(N);
+
+        std::span< double > src{ src_data.get(), N };
+        std::span< double > dst{ dst_data.get(), N };
+
+        for (size_t i = 0; i < N; ++i)
+        {
+            src[i] = distrib(gen);
+            dst[i] = 0.0;
+        }
+
+        gen::averageSpanFastPath(dst, src);
+
+        for (size_t i = 1; i < N - 1; ++i)
+        {
+            const double desired = one_third * ( src[i - 1] + src[i] + src[i + 1] );
+            assert( std::abs(desired - dst[i]) < 1e-12 );
+        }
+    }
+
+    namespace stdex = std::experimental;
+    using strided_t = stdex::mdspan<double, stdex::extents<uint64_t, std::dynamic_extent>, stdex::layout_stride>;
+
+    /* Exercises both the contiguous variant (stride 1) and the strided fallback (stride > 1) */
+    void test_mdspan_fast_path_kernel(uint64_t stride)
+    {
+        std::random_device rd;
+        std::mt19937 gen{ rd() };
+        std::uniform_real_distribution<double> distrib{-1.0, 1.0};
+
+        auto src_data = std::make_unique< double[] >(N * stride);
+        auto dst_data = std::make_unique< double[] >(N * stride);
+
+        using mapping_t = strided_t::mapping_type;
+        const mapping_t mapping{ strided_t::extents_type{ N }, std::array<uint64_t, 1>{ stride } };
+
+        strided_t src{ src_data.get(), mapping };
+        strided_t dst{ dst_data.get(), mapping };
+
+        for (size_t i = 0; i < N * stride; ++i)
+        {
+            src_data[i] = distrib(gen);
+            dst_data[i] = 0.0;
+        }
+
+        gen::averageMdspanFastPath(dst, src);
+
+        for (size_t i = 1; i < N - 1; ++i)
+        {
+            const double desired = one_third * ( src(i - 1) + src(i) + src(i + 1) );
+            assert( std::abs(desired - dst(i)) < 1e-12 );
+        }
+
+        /* Gaps between strided entries must remain untouched */
+        for (size_t i = 0; i < N * stride; ++i)
+        {
+            if (i % stride != 0)
+            {
+                assert( dst_data[i] == 0.0 );
+            }
+        }
+    }
+
+    void test_span_int32_kernel()
+    {
+        std::random_device rd;
+        std::mt19937 gen{ rd() };
+        std::uniform_real_distribution<double> distrib{-1.0, 1.0};
+
+        auto src_data = std::make_unique< double[] >(N);
+        auto dst_data = std::make_unique< double[] >(N);
+
+        std::span< double > src{ src_data.get(), N };
+        std::span< double > dst{ dst_data.get(), N };
+
+        for (size_t i = 0; i < N; ++i)
+        {
+            src[i] = distrib(gen);
+            dst[i] = 0.0;
+        }
+
+        gen::averageSpanInt32(dst, src);
+
+        for (size_t i = 1; i < N - 1; ++i)
+        {
+            const double desired = one_third * ( src[i - 1] + src[i] + src[i + 1] );
+            assert( std::abs(desired - dst[i]) < 1e-12 );
+        }
+    }
+
 }
 
 
 int main(void)
 {
     StlContainers1D::test_vector_kernel();
+    StlContainers1D::test_aligned_vector_kernel();
     StlContainers1D::test_span_kernel();
+    StlContainers1D::test_span_fast_path_kernel();
+    StlContainers1D::test_mdspan_fast_path_kernel(1);
+    StlContainers1D::test_mdspan_fast_path_kernel(3);
+    StlContainers1D::test_span_int32_kernel();
     return 0;
 }
@@ -4,6 +4,7 @@ import sympy as sp
 from pystencilssfg import SourceFileGenerator
 from pystencilssfg.lang.cpp import std
 
+std.mdspan.configure(namespace="std::experimental", header="<experimental/mdspan>")
 
 with SourceFileGenerator() as sfg:
     sfg.namespace("StlContainers1D::gen")
@@ -20,8 +21,39 @@ with SourceFileGenerator() as sfg:
         sfg.call(kernel),
     )
 
+    src_aligned = sfg.aligned_vector("double", 64, ref=True, const=True).var("src")
+    dst_aligned = sfg.aligned_vector("double", 64, ref=True).var("dst")
+
+    sfg.function("averageAlignedVector")(
+        sfg.map_field(src, src_aligned),
+        sfg.map_field(dst, dst_aligned),
+        sfg.call(kernel),
+    )
+
     sfg.function("averageSpan")(
         sfg.map_field(src, std.span.from_field(src)),
         sfg.map_field(dst, std.span.from_field(dst)),
         sfg.call(kernel),
     )
+
+    kernel_fast = sfg.kernels.create(asms, "average_fast", contiguous_fast_path=True)
+
+    sfg.function("averageSpanFastPath")(
+        sfg.map_field(src, std.span.from_field(src)),
+        sfg.map_field(dst, std.span.from_field(dst)),
+        sfg.call(kernel_fast),
+    )
+
+    sfg.function("averageMdspanFastPath")(
+        sfg.map_field(src, std.mdspan.from_field(src, layout_policy="layout_stride")),
+        sfg.map_field(dst, std.mdspan.from_field(dst, layout_policy="layout_stride")),
+        sfg.call(kernel_fast),
+    )
+
+    kernel_int32 = sfg.kernels.create(asms, "average_narrow", int32_indexing=True)
+
+    sfg.function("averageSpanInt32")(
+        sfg.map_field(src, std.span.from_field(src)),
+        sfg.map_field(dst, std.span.from_field(dst)),
+        sfg.call(kernel_int32),
+    )
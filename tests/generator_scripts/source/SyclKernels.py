@@ -3,6 +3,7 @@ import pystencils as ps
 
 from pystencilssfg import SourceFileGenerator, SfgConfig
 from pystencilssfg.extensions.sycl import SyclComposer
+from pystencilssfg.lang.cpp import sycl as sycl_lang
 
 cfg = SfgConfig()
 cfg.header_only = True
@@ -31,3 +32,30 @@ with SourceFileGenerator(cfg) as sfg:
             sfg.call(poisson_kernel)
         )
     )
+
+    nd_config = ps.CreateKernelConfig(target=ps.Target.SYCL)
+    nd_config.sycl.automatic_block_size = False
+    poisson_kernel_nd = sfg.kernels.create(
+        poisson_jacobi, "poisson_jacobi_nd", nd_config
+    )
+
+    sfg.function("invoke_parallel_for_nd_range")(
+        cgh.parallel_for(rang, (8, 8), reqd_work_group_size=(8, 8))(
+            sfg.call(poisson_kernel_nd)
+        )
+    )
+
+    q = sfg.sycl_queue("queue")
+    e_prev = sfg.sycl_event("prev")
+    e_done = sfg.sycl_event("done")
+    usm_mappings = [
+        sfg.map_field(fld, sycl_lang.usm_pointer.from_field(fld))
+        for fld in (u_src, u_dst, f)
+    ]
+
+    sfg.function("submit_usm").returns(e_done.dtype)(
+        q.parallel_for(rang, depends_on=[e_prev], event=e_done)(
+            *usm_mappings, sfg.call(poisson_kernel)
+        ),
+        f"return {e_done};",
+    )
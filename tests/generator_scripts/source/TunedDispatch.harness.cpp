@@ -0,0 +1,63 @@
+#include "TunedDispatch.hpp"
+
+#include <vector>
+#include <random>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#undef NDEBUG
+#include <cassert>
+
+namespace TunedDispatch
+{
+    constexpr double one_third { 1.0 / 3.0 };
+
+    void test_tuned_kernel(size_t N)
+    {
+        std::random_device rd;
+        std::mt19937 gen{ rd() };
+        std::uniform_real_distribution<double> distrib{-1.0, 1.0};
+
+        std::vector<double> src(N);
+        std::vector<double> dst(N, 0.0);
+
+        for (size_t i = 0; i < N; ++i)
+        {
+            src[i] = distrib(gen);
+        }
+
+        gen::averageTuned(dst, src);
+
+        for (size_t i = 1; i < N - 1; ++i)
+        {
+            const double desired = one_third * ( src[i - 1] + src[i] + src[i + 1] );
+            assert( std::abs(desired - dst[i]) < 1e-12 );
+        }
+    }
+}
+
+int main(void)
+{
+    std::remove("TunedDispatch.tuning");
+
+    /* First invocation for each size runs the tuning sweep */
+    TunedDispatch::test_tuned_kernel(974);
+    TunedDispatch::test_tuned_kernel(2048);
+
+    /* Repeated invocation dispatches to the tuned variant */
+    TunedDispatch::test_tuned_kernel(974);
+
+    std::ifstream cache { "TunedDispatch.tuning" };
+    std::string line;
+    size_t entries { 0 };
+    while (std::getline(cache, line))
+    {
+        ++entries;
+        assert( line.find("average_") != std::string::npos );
+    }
+    assert( entries == 2 );
+
+    return 0;
+}
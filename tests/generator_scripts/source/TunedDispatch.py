@@ -0,0 +1,28 @@
+import pystencils as ps
+import sympy as sp
+
+from pystencilssfg import SourceFileGenerator
+from pystencilssfg.lang.cpp import std
+
+
+with SourceFileGenerator() as sfg:
+    sfg.namespace("TunedDispatch::gen")
+
+    src, dst = ps.fields("src, dst: double[1D]")
+
+    asms = [ps.Assignment(dst[0], sp.Rational(1, 3) * (src[-1] + src[0] + src[1]))]
+
+    variants = sfg.kernels.create_variants(
+        asms,
+        "average",
+        {
+            "auto_gls": ps.CreateKernelConfig(),
+            "fixed_gls": ps.CreateKernelConfig(ghost_layers=1),
+        },
+    )
+
+    sfg.function("averageTuned")(
+        sfg.map_field(src, std.vector.from_field(src)),
+        sfg.map_field(dst, std.vector.from_field(dst)),
+        sfg.tuned_dispatch(variants, cache_file='"TunedDispatch.tuning"'),
+    )
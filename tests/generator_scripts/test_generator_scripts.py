@@ -5,6 +5,8 @@ For more information, refer to the `README.md` file in the same directory.
 
 import pytest
 
+import os
+import json
 import pathlib
 import yaml
 import re
@@ -31,6 +33,13 @@ CXX_INCLUDE_FLAGS = [
     PYSTENCILS_RT_INCLUDE_PATH,
 ]
 
+#   Benchmark mode; see `README.md`
+BENCHMARK_MODE = os.environ.get("SFG_BENCHMARK", "0") == "1"
+BENCHMARK_BASELINES_DIR = pathlib.Path(
+    os.environ.get("SFG_BENCHMARK_BASELINES", THIS_DIR / "baselines")
+)
+BENCHMARK_UPDATE_BASELINES = os.environ.get("SFG_BENCHMARK_UPDATE", "0") == "1"
+
 
 def prepare_deps():
     mdspan_archive_url = (
@@ -95,6 +104,10 @@ class GenScriptTest:
             config_module = SOURCE_DIR / config_module
             self._script_args += ["--sfg-config-module", str(config_module)]
 
+        self._impl_shards: int = sfg_args.get("impl-shards", 1)
+        if self._impl_shards > 1:
+            self._script_args += ["--sfg-impl-shards", str(self._impl_shards)]
+
         self._script_args += test_description.get("extra-args", [])
 
         self._expected_extensions = test_description.get(
@@ -112,6 +125,11 @@ class GenScriptTest:
             if ext in ("cpp", "cxx", "c++", "cu", "hip"):
                 self._files_to_compile.append(fname)
 
+                for i in range(1, self._impl_shards):
+                    shard_name = f"{self._name}_shard{i}.{ext}"
+                    self._expected_files.add(shard_name)
+                    self._files_to_compile.append(shard_name)
+
         compile_descr: dict = test_description.get("compile", dict())
         cxx_compiler: str = compile_descr.get("cxx", "g++")
 
@@ -140,6 +158,10 @@ class GenScriptTest:
 
         self._expect_code: dict = test_description.get("expect-code", dict())
 
+        self._benchmark: dict | None = test_description.get("benchmark", None)
+        if BENCHMARK_MODE and self._benchmark is not None and self._compile_cmd is not None:
+            self._compile_cmd += self._benchmark.get("cxx-flags", ["-O3", "-DNDEBUG"])
+
         harness_file = SOURCE_DIR / f"{self._name}.harness.cpp"
         if harness_file.exists():
             self._harness = harness_file
@@ -250,6 +272,65 @@ class GenScriptTest:
             if exe_result.returncode != 0:
                 pytest.fail(f"Execution of test harness for {self._name} failed.")
 
+            if BENCHMARK_MODE and self._benchmark is not None:
+                self.run_benchmark()
+
+    def run_benchmark(self):
+        assert self._benchmark is not None
+
+        bench_args = ["./a.out", "--benchmark"] + [
+            str(arg) for arg in self._benchmark.get("args", [])
+        ]
+        bench_result = subprocess.run(
+            bench_args, cwd=str(self._output_dir), capture_output=True, text=True
+        )
+        if bench_result.returncode != 0:
+            pytest.fail(f"Execution of benchmark for {self._name} failed.")
+
+        metrics: list[str] = self._benchmark.get(
+            "metrics", ["mlups", "gbytes_per_second"]
+        )
+        results: dict[str, dict[str, float]] = dict()
+        for line in bench_result.stdout.splitlines():
+            if line.startswith("{"):
+                report = json.loads(line)
+                results[report["kernel"]] = {m: report[m] for m in metrics}
+
+        baseline_file = BENCHMARK_BASELINES_DIR / f"{self._name}.json"
+        if BENCHMARK_UPDATE_BASELINES or not baseline_file.exists():
+            BENCHMARK_BASELINES_DIR.mkdir(parents=True, exist_ok=True)
+            with baseline_file.open("w") as f:
+                json.dump(results, f, indent=2, sort_keys=True)
+            pytest.skip(f"Recorded benchmark baseline {baseline_file}")
+
+        with baseline_file.open() as f:
+            baseline: dict[str, dict[str, float]] = json.load(f)
+
+        tolerance = float(
+            os.environ.get(
+                "SFG_BENCHMARK_TOLERANCE", self._benchmark.get("tolerance", 0.2)
+            )
+        )
+        regressions = [
+            f"    {kernel}: {metric} = {results[kernel][metric]:.4g}, "
+            f"baseline {value:.4g}"
+            for kernel, base_metrics in baseline.items()
+            for metric, value in base_metrics.items()
+            if kernel in results
+            and metric in results[kernel]
+            and results[kernel][metric] < (1 - tolerance) * value
+        ]
+        missing = sorted(set(baseline.keys()) - set(results.keys()))
+
+        if missing:
+            pytest.fail(f"Benchmark for {self._name} did not report kernels {missing}")
+
+        if regressions:
+            pytest.fail(
+                f"Performance of {self._name} regressed by more than {tolerance:.0%}:\n"
+                + "\n".join(regressions)
+            )
+
 
 def discover() -> list[GenScriptTest]:
     with TEST_INDEX.open() as indexfile:
@@ -65,3 +65,59 @@ def test_make_find_module(tmp_path):
 
     expected_path = tmp_path / "FindPystencilsSfg.cmake"
     assert expected_path.exists()
+
+
+BATCH_SCRIPT = """
+from pystencilssfg import SourceFileGenerator
+
+with SourceFileGenerator(keep_unknown_argv=True) as sfg:
+    sfg.code("// " + " ".join(sfg.context.argv))
+"""
+
+
+def test_batch(tmp_path):
+    scripts = []
+    for name in ("first", "second"):
+        script = tmp_path / f"{name}.py"
+        script.write_text(BATCH_SCRIPT)
+        scripts.append(str(script))
+
+    output_dir = tmp_path / "out"
+    args = (
+        ["sfg-cli", "batch"]
+        + scripts
+        + ["--args", "--sfg-output-dir", str(output_dir), "--sfg-header-only"]
+        + ["apples", "bananas"]
+    )
+
+    result = subprocess.run(args, capture_output=True, text=True)
+    assert result.returncode == 0, result.stderr
+
+    for name in ("first", "second"):
+        header = output_dir / f"{name}.hpp"
+        assert header.exists()
+        assert "// apples bananas" in header.read_text()
+
+
+def test_batch_failure(tmp_path):
+    good_script = tmp_path / "good.py"
+    good_script.write_text(BATCH_SCRIPT)
+    bad_script = tmp_path / "bad.py"
+    bad_script.write_text("raise RuntimeError('nope')\n")
+
+    output_dir = tmp_path / "out"
+    args = [
+        "sfg-cli",
+        "batch",
+        "--keep-going",
+        str(bad_script),
+        str(good_script),
+        "--args",
+        "--sfg-output-dir",
+        str(output_dir),
+    ]
+
+    result = subprocess.run(args, capture_output=True, text=True)
+    assert result.returncode == 1
+    assert "RuntimeError: nope" in result.stderr
+    assert (output_dir / "good.hpp").exists()
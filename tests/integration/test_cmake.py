@@ -49,3 +49,23 @@ def test_cmake_project(tmp_path, config_source):
     custom_dir_output = tmp_path / "my-output" / "CustomDirTest.hpp"
     assert custom_dir_output.exists()
     assert "#define NOTHING" in custom_dir_output.read_text()
+
+    for name in ("A", "B"):
+        batch_output = tmp_path / "batch-output" / f"BatchTest{name}.hpp"
+        assert batch_output.exists()
+        assert f"#define BATCH_TEST_{name}" in batch_output.read_text()
+
+    #   Touching a script regenerates its outputs; since their content is unchanged,
+    #   the generator keeps their modification times, and the stamp file alone marks them up to date.
+    gen_dir = tmp_path / "_gen" / "TestApp" / "gen"
+    stamp = gen_dir / ".GenTest.sfg-stamp"
+    assert stamp.exists()
+
+    (CMAKE_PROJECT_DIR / "GenTest.py").touch()
+    build_result = subprocess.run(cmake_build_cmd)
+    assert build_result.returncode == 0
+    stamp_mtime = stamp.stat().st_mtime_ns
+
+    build_result = subprocess.run(cmake_build_cmd)
+    assert build_result.returncode == 0
+    assert stamp.stat().st_mtime_ns == stamp_mtime
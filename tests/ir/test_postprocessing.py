@@ -1,3 +1,7 @@
+import os
+import time
+
+import pytest
 import sympy as sp
 from pystencils import (
     fields,
@@ -7,15 +11,16 @@ from pystencils import (
     FieldType,
     create_type,
     Assignment,
+    CreateKernelConfig,
 )
-from pystencils.types import PsCustomType
+from pystencils.types import PsCustomType, PsStructType
 
 from pystencilssfg.composer import make_sequence
 
 from pystencilssfg.lang import AugExpr, SupportsFieldExtraction
 from pystencilssfg.lang.cpp import std
 
-from pystencilssfg.ir import SfgStatements, SfgSequence
+from pystencilssfg.ir import SfgStatements, SfgSequence, SfgKernelCallNode
 from pystencilssfg.ir.postprocessing import CallTreePostProcessing
 
 
@@ -131,6 +136,51 @@ def test_field_extraction(sfg):
         assert stmt.code_string == line
 
 
+def test_aligned_field_extraction(sfg):
+    sx, sy, tx, ty = [
+        TypedSymbol(n, create_type("int64")) for n in ("sx", "sy", "tx", "ty")
+    ]
+    f = Field("f", FieldType.GENERIC, "double", (1, 0), (sx, sy), (tx, ty))
+
+    @kernel
+    def set_constant():
+        f.center @= 13.2
+
+    khandle = sfg.kernels.create(set_constant)
+
+    extraction = DemoFieldExtraction("f")
+    call_tree = make_sequence(
+        sfg.map_field(
+            f,
+            extraction,
+            cast_indexing_symbols=False,
+            alignment=64,
+            check_alignment=True,
+        ),
+        sfg.call(khandle),
+    )
+
+    pp = CallTreePostProcessing()
+    free_vars = pp.get_live_variables(call_tree)
+    assert free_vars == {extraction.obj.as_variable()}
+
+    assert isinstance(call_tree.children[0], SfgSequence)
+    assert_stmt, ptr_stmt = call_tree.children[0].children[:2]
+
+    #   The raw pointer is checked before its alignment is assumed
+    assert isinstance(assert_stmt, SfgStatements)
+    assert (
+        assert_stmt.code_string
+        == "assert( reinterpret_cast< std::uintptr_t >( f.ptr() ) % 64 == 0 );"
+    )
+
+    assert isinstance(ptr_stmt, SfgStatements)
+    assert (
+        ptr_stmt.code_string
+        == "double * RESTRICT const _data_f { std::assume_aligned< 64 >( f.ptr() ) };"
+    )
+
+
 def test_duplicate_field_shapes(sfg):
     N, tx, ty = [TypedSymbol(n, create_type("int64")) for n in ("N", "tx", "ty")]
     f = Field("f", FieldType.GENERIC, "double", (1, 0), (N, N), (tx, ty))
@@ -212,3 +262,104 @@ def test_scalar_fields(sfg):
         assert isinstance(node1, SfgStatements)
         assert isinstance(node2, SfgStatements)
         assert node1.code_string == node2.code_string
+
+
+def test_field_mapping_ignores_other_fields(sfg):
+    f, g = fields("f, g: double[2D]")
+
+    @kernel
+    def copy():
+        f[0, 0] @= g[0, 0]
+
+    khandle = sfg.kernels.create(copy)
+
+    call_tree = make_sequence(
+        sfg.map_field(f, DemoFieldExtraction("f")),
+        sfg.call(khandle),
+    )
+
+    pp = CallTreePostProcessing()
+    free_vars = pp.get_live_variables(call_tree)
+
+    #   Only the parameters of `f` are extracted; those of `g` remain free
+    expected = {DemoFieldExtraction("f").obj.as_variable()} | {
+        p for p in khandle.parameters if g in p.wrapped.fields
+    }
+    assert free_vars == expected
+
+
+def test_index_field_mapping(sfg):
+    f = fields("f: double[2D]")
+    idx = sfg.index_field("idx", "CellValue", 2, {"value": "double"})
+
+    assert idx.field_type == FieldType.INDEXED
+    assert idx.dtype.c_string() == "CellValue"
+    assert [m.name for m in idx.dtype.members] == ["x", "y", "value"]
+
+    khandle = sfg.kernels.create(
+        Assignment(f.center(), idx("value")),
+        "set_cells",
+        CreateKernelConfig(index_field=idx),
+    )
+
+    idx_vec = std.vector.from_field(idx, const=True)
+    call_tree = make_sequence(sfg.map_field(idx, idx_vec), sfg.call(khandle))
+
+    pp = CallTreePostProcessing()
+    free_vars = pp.get_live_variables(call_tree)
+
+    expected = {idx_vec.as_variable()} | {
+        p for p in khandle.parameters if f in p.wrapped.fields
+    }
+    assert free_vars == expected
+
+    with pytest.raises(ValueError):
+        sfg.index_field("idx4d", "Cell4D", 4)
+
+    with pytest.raises(ValueError):
+        sfg.index_field("idx_bad", "CellBad", 2, {"x": "double"})
+
+    anon = Field.create_generic(
+        "anon", 1, dtype=PsStructType([("x", "int32")]), field_type=FieldType.INDEXED
+    )
+    with pytest.raises(ValueError):
+        sfg.map_field(anon, DemoFieldExtraction("anon"))
+
+
+@pytest.mark.skipif(
+    os.environ.get("SFG_BENCHMARK", "0") != "1",
+    reason="Stress benchmark; set SFG_BENCHMARK=1 to run",
+)
+def test_postprocessing_stress(sfg):
+    """Post-processing of a function body with 10k kernel calls should scale linearly."""
+    n_fields = 64
+    fs = fields(", ".join(f"f{i}" for i in range(n_fields)) + ": double[3D]")
+
+    khandles = []
+    for i in range(0, n_fields, 2):
+        src, dst = fs[i], fs[i + 1]
+        asm = Assignment(dst.center(), src[1, 0, 0] + src[-1, 0, 0])
+        khandles.append(sfg.kernels.create(asm, f"kernel{i}"))
+
+    def make_tree(n_calls: int):
+        mappings = [sfg.map_field(f, DemoFieldExtraction(f.name)) for f in fs]
+        calls = [SfgKernelCallNode(khandles[i % len(khandles)]) for i in range(n_calls)]
+        #   Group calls into nested blocks of 100
+        blocks = [tuple(calls[i : i + 100]) for i in range(0, n_calls, 100)]
+        return make_sequence(*mappings, *blocks)
+
+    def postprocess(n_calls: int) -> float:
+        tree = make_tree(n_calls)
+        start = time.perf_counter()
+        free_vars = CallTreePostProcessing()(tree).function_params
+        seconds = time.perf_counter() - start
+
+        assert free_vars == {DemoFieldExtraction(f.name).obj.as_variable() for f in fs}
+        return seconds
+
+    t_small = postprocess(1_000)
+    t_large = postprocess(10_000)
+
+    assert t_large < 20 * t_small + 0.5, (
+        f"Post-processing took {t_small:.3f} s for 1k calls, but {t_large:.3f} s for 10k calls"
+    )
@@ -68,6 +68,33 @@ def test_vector_from_field():
         std.vector.from_field(f)
 
 
+def test_aligned_extraction():
+    f = ps.fields("f: float32[1D]")
+
+    f_vec = std.vector.from_field(
+        f, allocator="my::aligned_allocator< float, 64 >", alignment=64
+    )
+    assert (
+        no_spaces(f_vec.get_dtype().c_string())
+        == "std::vector<float,my::aligned_allocator<float,64>>&"
+    )
+    assert no_spaces(str(f_vec._extract_ptr())) == "std::assume_aligned<64>(f.data())"
+    assert HeaderFile.parse("<memory>") in includes(f_vec._extract_ptr())
+
+    f_span = std.span.from_field(f, alignment=32)
+    assert no_spaces(str(f_span._extract_ptr())) == "std::assume_aligned<32>(f.data())"
+
+    g = ps.fields("g: float32[2D]")
+    g_mdspan = std.mdspan.from_field(g, alignment=16)
+    assert (
+        no_spaces(str(g_mdspan._extract_ptr()))
+        == "std::assume_aligned<16>(g.data_handle())"
+    )
+
+    with pytest.raises(ValueError):
+        std.span.from_field(f, alignment=48)._extract_ptr()
+
+
 def test_span_from_field():
     f = ps.fields("f: float32[1D]")
     f_vec = std.span.from_field(f)
@@ -92,3 +119,21 @@ def test_span_from_field():
     f = ps.fields("f(1): dyn[1D]")
     with pytest.raises(ValueError):
         std.span.from_field(f)
+
+
+def test_aligned_vector(sfg):
+    vec = sfg.aligned_vector("float32", 64, ref=True).var("v")
+    assert (
+        no_spaces(vec.get_dtype().c_string())
+        == "std::vector<float,sfg_std::AlignedAllocator<float,64>>&"
+    )
+    assert no_spaces(str(vec._extract_ptr())) == "std::assume_aligned<64>(v.data())"
+
+    definition = std.vector.aligned_allocator_definition()
+    assert sfg.context.header_file.elements.count(definition) == 1
+
+    sfg.aligned_vector("float64", 32)
+    assert sfg.context.header_file.elements.count(definition) == 1
+
+    with pytest.raises(ValueError):
+        sfg.aligned_vector("float64", 48)
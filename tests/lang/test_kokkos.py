@@ -0,0 +1,110 @@
+import pytest
+
+import pystencils as ps
+
+from pystencilssfg.lang import kokkos, includes, HeaderFile
+
+
+def no_spaces(s: str):
+    return "".join(s.split())
+
+
+def test_view_types():
+    view = kokkos.View("double", (None, None)).var("v")
+    assert no_spaces(view.get_dtype().c_string()) == "Kokkos::View<double**>"
+    assert includes(view) == {HeaderFile.parse("<Kokkos_Core.hpp>")}
+
+    view = kokkos.View(
+        "float32",
+        (None, 4, 3),
+        layout="Kokkos::LayoutLeft",
+        memory_space="Kokkos::HostSpace",
+        ref=True,
+        const=True,
+    ).var("v")
+    assert (
+        no_spaces(view.get_dtype().c_string())
+        == "constKokkos::View<float*[4][3],Kokkos::LayoutLeft,Kokkos::HostSpace>&"
+    )
+    assert view.static_extents == (None, 4, 3)
+
+    #   Fixed extents preceding dynamic extents cannot be static
+    view = kokkos.View("int32", (3, None, 2)).var("v")
+    assert no_spaces(view.get_dtype().c_string()) == "Kokkos::View<int32_t**[2]>"
+    assert view.static_extents == (None, None, 2)
+
+    with pytest.raises(ValueError):
+        kokkos.View("double", (None,), layout="Kokkos::LayoutTiled")
+
+
+def test_view_extraction():
+    view = kokkos.View("double", (None, None, 3), alignment=64).var("v")
+
+    assert no_spaces(str(view._extract_ptr())) == "std::assume_aligned<64>(v.data())"
+    assert str(view._extract_size(0)) == "v.extent(0)"
+    assert str(view._extract_size(2)) == "3"
+    assert view._extract_size(3) is None
+    assert str(view._extract_stride(1)) == "v.stride(1)"
+    assert view._extract_stride(3) is None
+
+
+def test_view_from_field():
+    f = ps.fields("f(3): double[2D]", layout="c")
+    f_view = kokkos.View.from_field(f)
+
+    assert f_view.element_type == ps.create_type("double")
+    assert f_view.layout == "Kokkos::LayoutRight"
+    assert str(f_view) == f.name
+    assert (
+        no_spaces(f_view.get_dtype().c_string())
+        == "Kokkos::View<double**[3],Kokkos::LayoutRight>"
+    )
+
+    f = ps.fields("f(3): double[2D]", layout="fzyx")
+    assert kokkos.View.from_field(f).layout == "Kokkos::LayoutLeft"
+
+    f = ps.fields("f(3): double[2D]", layout="zyxf")
+    assert kokkos.View.from_field(f).layout == "Kokkos::LayoutStride"
+
+    with pytest.raises(ValueError):
+        kokkos.View.from_field(f, layout="Kokkos::LayoutRight")
+
+    g = ps.fields("g: float32[3D]", layout="fzyx")
+    g_view = kokkos.View.from_field(g, layout="Kokkos::LayoutStride")
+    assert g_view.layout == "Kokkos::LayoutStride"
+
+    with pytest.raises(ValueError):
+        kokkos.View.from_field(g, layout="Kokkos::LayoutRight")
+
+    h = ps.fields("h: dyn[2D]")
+    with pytest.raises(ValueError):
+        kokkos.View.from_field(h)
+
+
+def test_view_memory_spaces():
+    f = ps.fields("f: double[2D]")
+
+    f_view = kokkos.View.from_field(f, memory_space="Kokkos::CudaSpace")
+    assert f_view.compatible_with(ps.Target.CUDA)
+    assert not f_view.compatible_with(ps.Target.CPU)
+    assert not f_view.compatible_with(ps.Target.HIP)
+
+    f_view = kokkos.View.from_field(f, memory_space="Kokkos::CudaUVMSpace")
+    assert f_view.compatible_with(ps.Target.CUDA)
+    assert f_view.compatible_with(ps.Target.CPU)
+
+    f_view = kokkos.View.from_field(f, memory_space="Kokkos::SharedSpace")
+    assert f_view.compatible_with(ps.Target.HIP)
+
+    kokkos.View.from_field(f, memory_space="Kokkos::HostSpace", target=ps.Target.CPU)
+    kokkos.View.from_field(f, memory_space="Kokkos::HIPSpace", target=ps.Target.HIP)
+
+    with pytest.raises(ValueError):
+        kokkos.View.from_field(
+            f, memory_space="Kokkos::HostSpace", target=ps.Target.CUDA
+        )
+
+    with pytest.raises(ValueError):
+        kokkos.View.from_field(
+            f, memory_space="Kokkos::CudaSpace", target=ps.Target.CPU
+        )
@@ -34,3 +34,27 @@ def test_index_field(data_type, spatial_dim, index_dims):
     else:
         with pytest.raises(ValueError):
             sycl.accessor.from_field(f)
+
+
+@pytest.mark.parametrize("data_type", ["double", "float"])
+@pytest.mark.parametrize("dim", [1, 2, 3])
+def test_local_accessor(data_type, dim):
+    f = ps.fields(f"f:{data_type}[{dim}D]")
+    acc = sycl.local_accessor.from_field(f)
+    assert f"sycl::local_accessor< {data_type}, {dim} >" in str(acc.get_dtype())
+
+
+@pytest.mark.parametrize("dim", [1, 2, 3])
+def test_usm_pointer(dim):
+    f = ps.fields(f"f:double[{dim}D]")
+    ptr = sycl.usm_pointer.from_field(f)
+    assert str(ptr) == "f"
+    assert "double *" in ptr.get_dtype().c_string()
+    assert str(ptr.range) == "f_range"
+    assert f"sycl::range< {dim} >" in str(ptr.range.get_dtype())
+
+    assert str(ptr._extract_size(0)) == "f_range.get(0)"
+    assert str(ptr._extract_stride(dim - 1)) == "1"
+    if dim > 1:
+        expected = " * ".join(f"f_range.get({d})" for d in range(1, dim))
+        assert str(ptr._extract_stride(0)) == expected